@@ -28,6 +28,8 @@
 #include "audio/softsynth/opl/nuked.h"
 
 #include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/file.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/timer.h"
@@ -161,6 +163,25 @@ OPL *Config::create(OplType type) {
 }
 
 OPL *Config::create(DriverId driver, OplType type) {
+	OPL *opl = createDriver(driver, type);
+
+	if (opl && !ConfMan.get("opl_capture").empty()) {
+		// Engines may use several chips at once, or recreate them, so
+		// every instance after the first gets its own numbered file
+		static uint captureCount = 0;
+		Common::String filename = ConfMan.get("opl_capture");
+		if (captureCount)
+			filename += Common::String::format(".%d", captureCount);
+		++captureCount;
+
+		if (!opl->startCapture(filename, type))
+			warning("Could not capture OPL writes to \"%s\"", filename.c_str());
+	}
+
+	return opl;
+}
+
+OPL *Config::createDriver(DriverId driver, OplType type) {
 	// On invalid driver selection, we try to do some fallback detection
 	if (driver == -1) {
 		warning("Invalid OPL driver selected, trying to detect a fallback emulator");
@@ -293,7 +314,15 @@ EmulatedOPL::EmulatedOPL() :
 	_nextTick(0),
 	_samplesPerTick(0),
 	_baseFreq(0),
-	_handle(new Audio::SoundHandle()) {
+	_handle(new Audio::SoundHandle()),
+	_renderAhead(false),
+	_renderBuffer(0),
+	_renderBufferSize(0),
+	_renderBufferPos(0),
+	_renderBufferFill(0),
+	_underruns(0),
+	_captureFile(0),
+	_samplesRendered(0) {
 }
 
 EmulatedOPL::~EmulatedOPL() {
@@ -304,9 +333,153 @@ EmulatedOPL::~EmulatedOPL() {
 	stop();
 
 	delete _handle;
+	delete[] _renderBuffer;
+
+	if (_captureFile) {
+		captureWrite(kCaptureEnd, 0, 0);
+		_captureFile->finalize();
+		delete _captureFile;
+	}
+}
+
+bool EmulatedOPL::startCapture(const Common::String &filename, Config::OplType type) {
+	Common::DumpFile *file = new Common::DumpFile();
+	if (!file->open(filename)) {
+		delete file;
+		return false;
+	}
+
+	file->writeUint32BE(MKTAG('O', 'P', 'L', 'C'));
+	file->writeByte(kCaptureVersion);
+	file->writeByte(type);
+	file->writeUint32LE(getRate());
+
+	Common::StackLock lock(_writeMutex);
+	delete _captureFile;
+	_captureFile = file;
+	_samplesRendered = 0;
+
+	return true;
+}
+
+void EmulatedOPL::captureWrite(CaptureEntryType type, int address, int value) {
+	Common::StackLock lock(_writeMutex);
+
+	_captureFile->writeUint32LE(_samplesRendered);
+	_captureFile->writeByte(type);
+	_captureFile->writeUint16LE(address);
+	_captureFile->writeByte(value);
+}
+
+void EmulatedOPL::write(int a, int v) {
+	// The flag is only changed with the write queue locked, so a write is
+	// never queued after stopCallbacks() has flushed the queue
+	Common::StackLock lock(_writeMutex);
+
+	if (!_renderAhead) {
+		if (_captureFile)
+			captureWrite(kCapturePortWrite, a, v);
+		writeImmediate(a, v);
+		return;
+	}
+
+	QueuedWrite queuedWrite = { false, a, v };
+	_queuedWrites.push_back(queuedWrite);
+}
+
+void EmulatedOPL::writeReg(int r, int v) {
+	Common::StackLock lock(_writeMutex);
+
+	if (!_renderAhead) {
+		if (_captureFile)
+			captureWrite(kCaptureRegisterWrite, r, v);
+		writeRegImmediate(r, v);
+		return;
+	}
+
+	QueuedWrite queuedWrite = { true, r, v };
+	_queuedWrites.push_back(queuedWrite);
+}
+
+void EmulatedOPL::flushWrites() {
+	{
+		Common::StackLock lock(_writeMutex);
+		if (_queuedWrites.empty())
+			return;
+
+		// Swap the queue out, so writers are not blocked while the
+		// chip processes the writes
+		SWAP(_queuedWrites, _flushedWrites);
+	}
+
+	for (uint i = 0; i < _flushedWrites.size(); ++i) {
+		const QueuedWrite &queuedWrite = _flushedWrites[i];
+		if (_captureFile)
+			captureWrite(queuedWrite.isRegister ? kCaptureRegisterWrite : kCapturePortWrite, queuedWrite.address, queuedWrite.value);
+
+		if (queuedWrite.isRegister)
+			writeRegImmediate(queuedWrite.address, queuedWrite.value);
+		else
+			writeImmediate(queuedWrite.address, queuedWrite.value);
+	}
+
+	_flushedWrites.clear();
 }
 
 int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
+	if (!_renderAhead) {
+		renderSamples(buffer, numSamples);
+		return numSamples;
+	}
+
+	Common::StackLock lock(_renderMutex);
+
+	int copied = 0;
+	while (copied < numSamples && _renderBufferFill) {
+		const uint step = MIN<uint>(MIN<uint>(numSamples - copied, _renderBufferFill), _renderBufferSize - _renderBufferPos);
+
+		memcpy(buffer + copied, _renderBuffer + _renderBufferPos, step * sizeof(int16));
+
+		copied += step;
+		_renderBufferFill -= step;
+		_renderBufferPos = (_renderBufferPos + step) % _renderBufferSize;
+	}
+
+	if (copied < numSamples) {
+		// The timer proc did not keep up, so render the rest right here
+		++_underruns;
+		debug(1, "EmulatedOPL: Render-ahead buffer underrun (%d samples missing, %d underruns)", numSamples - copied, _underruns);
+		renderSamples(buffer + copied, numSamples - copied);
+	}
+
+	return numSamples;
+}
+
+void EmulatedOPL::renderAheadProc(void *refCon) {
+	static_cast<EmulatedOPL *>(refCon)->renderAhead();
+}
+
+void EmulatedOPL::renderAhead() {
+	const uint stereoFactor = isStereo() ? 2 : 1;
+
+	while (true) {
+		// Only hold the lock for one chunk at a time, so the mixer
+		// callback never has to wait long for the buffer
+		Common::StackLock lock(_renderMutex);
+
+		if (_renderBufferFill == _renderBufferSize)
+			break;
+
+		const uint writePos = (_renderBufferPos + _renderBufferFill) % _renderBufferSize;
+		uint step = MIN<uint>(kRenderAheadChunk * stereoFactor, _renderBufferSize - _renderBufferFill);
+		step = MIN<uint>(step, _renderBufferSize - writePos);
+
+		renderSamples(_renderBuffer + writePos, step);
+		_renderBufferFill += step;
+	}
+}
+
+void EmulatedOPL::renderSamples(int16 *buffer, int numSamples) {
 	const int stereoFactor = isStereo() ? 2 : 1;
 	int len = numSamples / stereoFactor;
 	int step;
@@ -316,7 +489,13 @@ int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
 		if (step > (_nextTick >> FIXP_SHIFT))
 			step = (_nextTick >> FIXP_SHIFT);
 
+		// Writes made by the callback or by other threads since the
+		// last step are due now
+		if (_renderAhead)
+			flushWrites();
+
 		generateSamples(buffer, step * stereoFactor);
+		_samplesRendered += step;
 
 		_nextTick -= step << FIXP_SHIFT;
 		if (!(_nextTick >> FIXP_SHIFT)) {
@@ -329,8 +508,6 @@ int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
 		buffer += step * stereoFactor;
 		len -= step;
 	} while (len);
-
-	return numSamples;
 }
 
 int EmulatedOPL::getRate() const {
@@ -339,10 +516,45 @@ int EmulatedOPL::getRate() const {
 
 void EmulatedOPL::startCallbacks(int timerFrequency) {
 	setCallbackFrequency(timerFrequency);
+
+	const int latency = ConfMan.getInt("opl_render_ahead");
+	if (latency > 0) {
+		const uint stereoFactor = isStereo() ? 2 : 1;
+
+		delete[] _renderBuffer;
+		_renderBufferSize = MAX<uint>(getRate() * latency / 1000, kRenderAheadChunk) * stereoFactor;
+		_renderBuffer = new int16[_renderBufferSize];
+		_renderBufferPos = 0;
+		_renderBufferFill = 0;
+		_underruns = 0;
+
+		{
+			Common::StackLock lock(_writeMutex);
+			_renderAhead = true;
+		}
+
+		// Top up the buffer twice per latency period
+		g_system->getTimerManager()->installTimerProc(renderAheadProc, MAX(latency * 1000 / 2, 10000), this, "EmulatedOPL");
+	}
+
 	g_system->getMixer()->playStream(Audio::Mixer::kPlainSoundType, _handle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 }
 
 void EmulatedOPL::stopCallbacks() {
+	if (_renderAhead) {
+		g_system->getTimerManager()->removeTimerProc(renderAheadProc);
+
+		// Apply whatever is still queued, so the chip state is up to date.
+		// Holding the write lock keeps writers from queueing in between.
+		Common::StackLock renderLock(_renderMutex);
+		Common::StackLock writeLock(_writeMutex);
+		_renderAhead = false;
+		flushWrites();
+
+		if (_underruns)
+			debug(1, "EmulatedOPL: %d render-ahead buffer underruns", _underruns);
+	}
+
 	g_system->getMixer()->stopHandle(*_handle);
 }
 
@@ -25,7 +25,9 @@
 
 #include "audio/audiostream.h"
 
+#include "common/array.h"
 #include "common/func.h"
+#include "common/mutex.h"
 #include "common/ptr.h"
 #include "common/scummsys.h"
 
@@ -34,6 +36,7 @@ class SoundHandle;
 }
 
 namespace Common {
+class DumpFile;
 class String;
 }
 
@@ -104,6 +107,28 @@ public:
 
 private:
 	static const EmulatorDescription _drivers[];
+
+	static OPL *createDriver(DriverId driver, OplType type);
+};
+
+/**
+ * Entry types of an OPL register capture file.
+ *
+ * A capture file starts with the tag 'OPLC' (big endian), a version byte
+ * (kCaptureVersion), the OplType byte and the output sample rate as
+ * 32 bit little endian value. It is followed by entries of 8 bytes each:
+ * the position in samples (per channel) since the start of the capture as
+ * 32 bit value, the entry type byte and the 16 bit port or register
+ * address, all little endian, and the value byte.
+ */
+enum CaptureEntryType {
+	kCapturePortWrite = 0,
+	kCaptureRegisterWrite = 1,
+	kCaptureEnd = 0xFF
+};
+
+enum {
+	kCaptureVersion = 1
 };
 
 /**
@@ -176,6 +201,19 @@ public:
 	 */
 	virtual void setCallbackFrequency(int timerFrequency) = 0;
 
+	/**
+	 * Start recording all writes together with their timestamps into the
+	 * given file. See CaptureEntryType for the file format. This is
+	 * automatically done by Config::create() when the "opl_capture"
+	 * config option names a file. Every OPL created after the first one
+	 * then captures into that name with ".1", ".2" and so on appended.
+	 *
+	 * @param filename	name of the capture file
+	 * @param type		the emulated chip type, stored in the file header
+	 * @return		true on success, false if capturing is not supported
+	 */
+	virtual bool startCapture(const Common::String &filename, Config::OplType type) { return false; }
+
 	enum {
 		/**
 		 * The default callback frequency that start() uses
@@ -236,6 +274,13 @@ private:
  *
  * This will send callbacks based on the number of samples
  * decoded in readBuffer().
+ *
+ * When the "opl_render_ahead" config option is set to a latency in
+ * milliseconds, samples are rendered ahead of time from a timer proc
+ * into a buffer of that size, and readBuffer() only copies them out.
+ * Register writes are then queued and applied to the chip in order
+ * at the next rendering step, so they become audible with a delay of
+ * at most the configured latency.
  */
 class EmulatedOPL : public OPL, protected Audio::AudioStream {
 public:
@@ -243,8 +288,18 @@ public:
 	virtual ~EmulatedOPL();
 
 	// OPL API
+	void write(int a, int v);
+	void writeReg(int r, int v);
 	void setCallbackFrequency(int timerFrequency);
 
+	bool startCapture(const Common::String &filename, Config::OplType type);
+
+	/**
+	 * Returns the number of times the render-ahead buffer ran empty and
+	 * samples had to be rendered inside the mixer callback.
+	 */
+	uint getUnderrunCount() const { return _underruns; }
+
 	// AudioStream API
 	int readBuffer(int16 *buffer, const int numSamples);
 	int getRate() const;
@@ -267,6 +322,22 @@ protected:
 	 */
 	virtual void generateSamples(int16 *buffer, int numSamples) = 0;
 
+	/**
+	 * Writes a byte to the given I/O port of the emulated chip right away.
+	 *
+	 * @param a		port address
+	 * @param v		value, which will be written
+	 */
+	virtual void writeImmediate(int a, int v) = 0;
+
+	/**
+	 * Writes to the given register of the emulated chip right away.
+	 *
+	 * @param r		hardware register number to write to
+	 * @param v		value, which will be written
+	 */
+	virtual void writeRegImmediate(int r, int v) = 0;
+
 private:
 	int _baseFreq;
 
@@ -278,6 +349,53 @@ private:
 	int _samplesPerTick;
 
 	Audio::SoundHandle *_handle;
+
+	/**
+	 * Renders samples and runs the timer callbacks in between.
+	 */
+	void renderSamples(int16 *buffer, int numSamples);
+
+	/**
+	 * Applies all queued register writes to the chip.
+	 */
+	void flushWrites();
+
+	/**
+	 * Records a write which is applied to the chip in the capture file.
+	 */
+	void captureWrite(CaptureEntryType type, int address, int value);
+
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+
+	struct QueuedWrite {
+		bool isRegister;
+		int address;
+		int value;
+	};
+
+	enum {
+		/**
+		 * Number of samples per channel rendered at once by the render-ahead
+		 * timer proc. This is also the granularity of queued register writes.
+		 */
+		kRenderAheadChunk = 128
+	};
+
+	bool _renderAhead;
+	Common::Mutex _renderMutex;	///< Guards the chip state and the render-ahead buffer
+	Common::Mutex _writeMutex;	///< Guards the write queue
+	Common::Array<QueuedWrite> _queuedWrites;
+	Common::Array<QueuedWrite> _flushedWrites;
+
+	int16 *_renderBuffer;
+	uint _renderBufferSize;
+	uint _renderBufferPos;
+	uint _renderBufferFill;
+	uint _underruns;
+
+	Common::DumpFile *_captureFile;
+	uint32 _samplesRendered;	///< Samples per channel rendered so far, the capture timestamp
 };
 
 } // End of namespace OPL
@@ -35,6 +35,7 @@
 #include "common/events.h"
 #include "common/file.h"
 #include "common/system.h"
+#include "common/timer.h"
 #include "common/util.h"
 #include "common/archive.h"
 #include "common/textconsole.h"
@@ -113,6 +114,43 @@ private:
 
 	int _outputRate;
 
+	// When the "mt32_render_ahead" config option is set to a buffer depth
+	// in milliseconds, samples are rendered ahead of time from a timer proc,
+	// so the mixer callback only has to copy them out of a ring buffer.
+	// The player timer callback then runs from its own timer proc, as it
+	// does for hardware MIDI devices, and all MIDI events are put into
+	// munt's event queue with a timestamp one buffer depth after the current
+	// playback position, so they all get the same latency.
+	enum {
+		kRenderAheadChunk = 256	///< Samples per channel rendered at once by the timer proc
+	};
+
+	int16 *_renderBuffer;
+	uint _renderBufferSize;
+	uint _renderBufferPos;
+	uint _renderBufferFill;
+	uint32 _renderAheadDepth;	///< The buffer depth in samples per channel
+	Common::Mutex _renderMutex;	///< Serializes rendering between the timer proc and buffer underruns
+	Common::Mutex _bufferMutex;	///< Guards the ring buffer and playback positions
+	uint32 _playedSamples;		///< Samples per channel taken by the mixer so far
+	uint32 _playedMillis;		///< Time at which the mixer last took samples
+	uint32 _playedStep;			///< Samples per channel the mixer took last time
+	uint _underruns;
+
+	Common::TimerManager::TimerProc _playerTimerProc;
+	void *_playerTimerParam;
+
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+	static void playerTimerProc(void *refCon);
+	void advancePlayback(uint32 samples);
+
+	/**
+	 * Returns the munt timestamp for a MIDI event sent now, or 0 if the
+	 * event should be played immediately.
+	 */
+	uint32 getEventTimestamp();
+
 protected:
 	void generateSamples(int16 *buf, int len);
 
@@ -125,12 +163,14 @@ public:
 	void send(uint32 b);
 	void setPitchBendRange(byte channel, uint range);
 	void sysEx(const byte *msg, uint16 length);
+	void setTimerCallback(void *timer_param, Common::TimerManager::TimerProc timer_proc);
 
 	uint32 property(int prop, uint32 param);
 	MidiChannel *allocateChannel();
 	MidiChannel *getPercussionChannel();
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples);
 	bool isStereo() const { return true; }
 	int getRate() const { return _outputRate; }
 };
@@ -150,6 +190,17 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderBuffer = nullptr;
+	_renderBufferSize = 0;
+	_renderBufferPos = 0;
+	_renderBufferFill = 0;
+	_renderAheadDepth = 0;
+	_playedSamples = 0;
+	_playedMillis = 0;
+	_playedStep = 0;
+	_underruns = 0;
+	_playerTimerProc = nullptr;
+	_playerTimerParam = nullptr;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -221,14 +272,55 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	_playedSamples = 0;
+	_playedMillis = g_system->getMillis();
+	_playedStep = 0;
+	_underruns = 0;
+
+	const int renderAheadTime = ConfMan.getInt("mt32_render_ahead");
+	if (renderAheadTime > 0) {
+		_renderAheadDepth = MAX<uint32>(_outputRate * renderAheadTime / 1000, kRenderAheadChunk);
+		// Leave room for one more chunk, so the buffer can be kept at full depth
+		_renderBufferSize = (_renderAheadDepth + kRenderAheadChunk) * 2;
+		_renderBuffer = new int16[_renderBufferSize];
+		_renderBufferPos = 0;
+		_renderBufferFill = 0;
+
+		// Fill the buffer before playback starts, and keep it filled from
+		// then on by topping it up twice per buffer period
+		renderAhead();
+		g_system->getTimerManager()->installTimerProc(renderAheadProc, MAX(renderAheadTime * 1000 / 2, 10000), this, "MT32RenderAhead");
+
+		// Move a player callback set before opening to its own timer proc
+		if (_playerTimerProc)
+			setTimerCallback(_playerTimerParam, _playerTimerProc);
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
 }
 
+uint32 MidiDriver_MT32::getEventTimestamp() {
+	// Must be called with _mutex held
+	if (!_renderBuffer)
+		return 0;
+
+	Common::StackLock bufferLock(_bufferMutex);
+	// The mixer takes samples in large blocks, so interpolate the playback
+	// position from the time passed since it last did, up to one block
+	const uint32 elapsedMillis = MIN<uint32>(g_system->getMillis() - _playedMillis, 1000);
+	const uint32 elapsed = MIN<uint32>(elapsedMillis * _outputRate / 1000, _playedStep);
+	return _service.convertOutputToSynthTimestamp(_playedSamples + elapsed + _renderAheadDepth);
+}
+
 void MidiDriver_MT32::send(uint32 b) {
 	Common::StackLock lock(_mutex);
-	_service.playMsg(b);
+	const uint32 timestamp = getEventTimestamp();
+	if (timestamp)
+		_service.playMsgAt(b, timestamp);
+	else
+		_service.playMsg(b);
 }
 
 // Indiana Jones and the Fate of Atlantis (including the demo) uses
@@ -245,7 +337,11 @@ void MidiDriver_MT32::setPitchBendRange(byte channel, uint range) {
 void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 	if (msg[0] == 0xf0) {
 		Common::StackLock lock(_mutex);
-		_service.playSysex(msg, length);
+		const uint32 timestamp = getEventTimestamp();
+		if (timestamp)
+			_service.playSysexAt(msg, length, timestamp);
+		else
+			_service.playSysex(msg, length);
 	} else {
 		enum {
 			SYSEX_CMD_DT1 = 0x12,
@@ -268,9 +364,15 @@ void MidiDriver_MT32::close() {
 
 	// Detach the player callback handler
 	setTimerCallback(NULL, NULL);
+	// Stop rendering ahead
+	if (_renderBuffer)
+		g_system->getTimerManager()->removeTimerProc(renderAheadProc);
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+	if (_underruns)
+		debug(1, "MT32Emu: %d render-ahead buffer underruns", _underruns);
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -278,6 +380,119 @@ void MidiDriver_MT32::close() {
 	_controlData = nullptr;
 	delete[] _pcmData;
 	_pcmData = nullptr;
+	delete[] _renderBuffer;
+	_renderBuffer = nullptr;
+}
+
+void MidiDriver_MT32::setTimerCallback(void *timer_param, Common::TimerManager::TimerProc timer_proc) {
+	if (!_renderBuffer) {
+		_playerTimerProc = timer_proc;
+		_playerTimerParam = timer_param;
+		MidiDriver_Emulated::setTimerCallback(timer_param, timer_proc);
+		return;
+	}
+
+	// When rendering ahead, the callback cannot run in between the rendering
+	// steps, since its events could then not be told apart from the ones the
+	// engine thread sends meanwhile. It gets a timer proc of its own instead,
+	// and its events are timestamped like all others.
+	Common::TimerManager *timer = g_system->getTimerManager();
+	timer->removeTimerProc(playerTimerProc);
+	MidiDriver_Emulated::setTimerCallback(NULL, NULL);
+
+	_playerTimerProc = timer_proc;
+	_playerTimerParam = timer_param;
+	if (timer_proc)
+		timer->installTimerProc(playerTimerProc, getBaseTempo(), this, "MT32Player");
+}
+
+void MidiDriver_MT32::playerTimerProc(void *refCon) {
+	MidiDriver_MT32 *driver = static_cast<MidiDriver_MT32 *>(refCon);
+	(*driver->_playerTimerProc)(driver->_playerTimerParam);
+}
+
+void MidiDriver_MT32::renderAheadProc(void *refCon) {
+	static_cast<MidiDriver_MT32 *>(refCon)->renderAhead();
+}
+
+void MidiDriver_MT32::renderAhead() {
+	int16 chunk[kRenderAheadChunk * 2];
+
+	while (true) {
+		Common::StackLock renderLock(_renderMutex);
+
+		uint writePos;
+		{
+			Common::StackLock bufferLock(_bufferMutex);
+			if (_renderBufferFill >= _renderAheadDepth * 2)
+				break;
+			writePos = (_renderBufferPos + _renderBufferFill) % _renderBufferSize;
+		}
+
+		// Render outside of the buffer lock, so the mixer callback can
+		// keep copying samples out in the meantime
+		MidiDriver_Emulated::readBuffer(chunk, kRenderAheadChunk * 2);
+
+		for (uint i = 0; i < kRenderAheadChunk * 2; ++i)
+			_renderBuffer[(writePos + i) % _renderBufferSize] = chunk[i];
+
+		Common::StackLock bufferLock(_bufferMutex);
+		_renderBufferFill += kRenderAheadChunk * 2;
+	}
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_renderBuffer) {
+		MidiDriver_Emulated::readBuffer(data, numSamples);
+		advancePlayback(numSamples / 2);
+		return numSamples;
+	}
+
+	int copied = 0;
+	bool underrun = false;
+
+	while (copied < numSamples) {
+		{
+			Common::StackLock bufferLock(_bufferMutex);
+			while (copied < numSamples && _renderBufferFill) {
+				const uint step = MIN<uint>(MIN<uint>(numSamples - copied, _renderBufferFill), _renderBufferSize - _renderBufferPos);
+
+				memcpy(data + copied, _renderBuffer + _renderBufferPos, step * sizeof(int16));
+
+				copied += step;
+				_renderBufferFill -= step;
+				_renderBufferPos = (_renderBufferPos + step) % _renderBufferSize;
+			}
+		}
+
+		if (copied == numSamples || underrun)
+			break;
+
+		// The timer proc did not keep up. Wait for the chunk it may be
+		// rendering right now, and take whatever it produced before
+		// rendering the rest here.
+		underrun = true;
+		_renderMutex.lock();
+	}
+
+	if (underrun) {
+		if (copied < numSamples) {
+			++_underruns;
+			debug(1, "MT32Emu: Render-ahead buffer underrun (%d samples missing, %d underruns)", numSamples - copied, _underruns);
+			MidiDriver_Emulated::readBuffer(data + copied, numSamples - copied);
+		}
+		_renderMutex.unlock();
+	}
+
+	advancePlayback(numSamples / 2);
+	return numSamples;
+}
+
+void MidiDriver_MT32::advancePlayback(uint32 samples) {
+	Common::StackLock bufferLock(_bufferMutex);
+	_playedSamples += samples;
+	_playedMillis = g_system->getMillis();
+	_playedStep = samples;
 }
 
 void MidiDriver_MT32::generateSamples(int16 *data, int len) {
@@ -334,9 +334,18 @@ bool Partial::generateNextSample(LA32PairImpl *la32PairImpl) {
 	return true;
 }
 
-void Partial::produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA32IntPartialPair *la32IntPair) {
-	IntSampleEx sample = la32IntPair->nextOutSample();
+template <class OutSample, class LA32PairImpl>
+Bit32u Partial::generateBlock(OutSample *block, Bit32u length, LA32PairImpl *la32PairImpl) {
+	Bit32u produced = 0;
+	while (produced < length) {
+		if (!generateNextSample(la32PairImpl)) break;
+		block[produced++] = la32PairImpl->nextOutSample();
+		sampleNum++;
+	}
+	return produced;
+}
 
+void Partial::mixBlock(IntSample *leftBuf, IntSample *rightBuf, const IntSampleEx *block, Bit32u length) const {
 	// FIXME: LA32 may produce distorted sound in case if the absolute value of maximal amplitude of the input exceeds 8191
 	// when the panning value is non-zero. Most probably the distortion occurs in the same way it does with ring modulation,
 	// and it seems to be caused by limited precision of the common multiplication circuit.
@@ -344,28 +353,42 @@ void Partial::produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA3
 	// by subtraction of the left channel output from the input.
 	// Though, it is unknown whether this overflow is exploited somewhere.
 
-	IntSampleEx leftOut = ((sample * leftPanValue) >> 13) + IntSampleEx(*leftBuf);
-	IntSampleEx rightOut = ((sample * rightPanValue) >> 13) + IntSampleEx(*rightBuf);
-	*(leftBuf++) = Synth::clipSampleEx(leftOut);
-	*(rightBuf++) = Synth::clipSampleEx(rightOut);
+	// Pan values are constant for the whole block, keeping them in locals lets the compiler vectorise this loop.
+	const Bit32s leftPan = leftPanValue;
+	const Bit32s rightPan = rightPanValue;
+	for (Bit32u i = 0; i < length; i++) {
+		leftBuf[i] = Synth::clipSampleEx(((block[i] * leftPan) >> 13) + IntSampleEx(leftBuf[i]));
+		rightBuf[i] = Synth::clipSampleEx(((block[i] * rightPan) >> 13) + IntSampleEx(rightBuf[i]));
+	}
 }
 
-void Partial::produceAndMixSample(FloatSample *&leftBuf, FloatSample *&rightBuf, LA32FloatPartialPair *la32FloatPair) {
-	FloatSample sample = la32FloatPair->nextOutSample();
-	FloatSample leftOut = (sample * leftPanValue) / 14.0f;
-	FloatSample rightOut = (sample * rightPanValue) / 14.0f;
-	*(leftBuf++) += leftOut;
-	*(rightBuf++) += rightOut;
+void Partial::mixBlock(FloatSample *leftBuf, FloatSample *rightBuf, const FloatSample *block, Bit32u length) const {
+	const FloatSample leftPan = FloatSample(leftPanValue);
+	const FloatSample rightPan = FloatSample(rightPanValue);
+	for (Bit32u i = 0; i < length; i++) {
+		leftBuf[i] += (block[i] * leftPan) / 14.0f;
+		rightBuf[i] += (block[i] * rightPan) / 14.0f;
+	}
 }
 
-template <class Sample, class LA32PairImpl>
+// The per-sample LA32 state machine (envelopes, pitch and wave phase) is inherently sequential,
+// so samples are first generated into a small block and then panned and mixed in a separate pass.
+template <class Sample, class OutSample, class LA32PairImpl>
 bool Partial::doProduceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length, LA32PairImpl *la32PairImpl) {
 	if (!canProduceOutput()) return false;
 	alreadyOutputed = true;
 
-	for (sampleNum = 0; sampleNum < length; sampleNum++) {
-		if (!generateNextSample(la32PairImpl)) break;
-		produceAndMixSample(leftBuf, rightBuf, la32PairImpl);
+	OutSample block[PARTIAL_BLOCK_SIZE];
+	sampleNum = 0;
+	while (length > 0) {
+		Bit32u blockLength = length;
+		if (blockLength > PARTIAL_BLOCK_SIZE) blockLength = PARTIAL_BLOCK_SIZE;
+		Bit32u produced = generateBlock(block, blockLength, la32PairImpl);
+		mixBlock(leftBuf, rightBuf, block, produced);
+		if (produced < blockLength) break;
+		leftBuf += produced;
+		rightBuf += produced;
+		length -= produced;
 	}
 	sampleNum = 0;
 	return true;
@@ -376,7 +399,7 @@ bool Partial::produceOutput(IntSample *leftBuf, IntSample *rightBuf, Bit32u leng
 		synth->printDebug("Partial: Invalid call to produceOutput()! Renderer = %d\n", synth->getSelectedRendererType());
 		return false;
 	}
-	return doProduceOutput(leftBuf, rightBuf, length, static_cast<LA32IntPartialPair *>(la32Pair));
+	return doProduceOutput<IntSample, IntSampleEx>(leftBuf, rightBuf, length, static_cast<LA32IntPartialPair *>(la32Pair));
 }
 
 bool Partial::produceOutput(FloatSample *leftBuf, FloatSample *rightBuf, Bit32u length) {
@@ -384,7 +407,7 @@ bool Partial::produceOutput(FloatSample *leftBuf, FloatSample *rightBuf, Bit32u
 		synth->printDebug("Partial: Invalid call to produceOutput()! Renderer = %d\n", synth->getSelectedRendererType());
 		return false;
 	}
-	return doProduceOutput(leftBuf, rightBuf, length, static_cast<LA32FloatPartialPair *>(la32Pair));
+	return doProduceOutput<FloatSample, FloatSample>(leftBuf, rightBuf, length, static_cast<LA32FloatPartialPair *>(la32Pair));
 }
 
 bool Partial::shouldReverb() {
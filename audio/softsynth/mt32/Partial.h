@@ -82,13 +82,18 @@ private:
 	Bit32u getAmpValue();
 	Bit32u getCutoffValue();
 
-	template <class Sample, class LA32PairImpl>
+	// Number of samples generated per partial before they are panned and mixed into the output buffers
+	static const Bit32u PARTIAL_BLOCK_SIZE = 128;
+
+	template <class Sample, class OutSample, class LA32PairImpl>
 	bool doProduceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length, LA32PairImpl *la32PairImpl);
 	bool canProduceOutput();
 	template <class LA32PairImpl>
 	bool generateNextSample(LA32PairImpl *la32PairImpl);
-	void produceAndMixSample(IntSample *&leftBuf, IntSample *&rightBuf, LA32IntPartialPair *la32IntPair);
-	void produceAndMixSample(FloatSample *&leftBuf, FloatSample *&rightBuf, LA32FloatPartialPair *la32FloatPair);
+	template <class OutSample, class LA32PairImpl>
+	Bit32u generateBlock(OutSample *block, Bit32u length, LA32PairImpl *la32PairImpl);
+	void mixBlock(IntSample *leftBuf, IntSample *rightBuf, const IntSampleEx *block, Bit32u length) const;
+	void mixBlock(FloatSample *leftBuf, FloatSample *rightBuf, const FloatSample *block, Bit32u length) const;
 
 public:
 	bool alreadyOutputed;
@@ -1405,7 +1405,7 @@ void OPL::reset() {
 	OPL3_Reset(&chip, _rate);
 }
 
-void OPL::write(int port, int val) {
+void OPL::writeImmediate(int port, int val) {
 	if (port & 1) {
 		switch (_type) {
 		case Config::kOpl2:
@@ -1449,7 +1449,7 @@ void OPL::write(int port, int val) {
 }
 
 
-void OPL::writeReg(int r, int v) {
+void OPL::writeRegImmediate(int r, int v) {
 	OPL3_WriteRegBuffered(&chip, (Bit16u)r, (Bit8u)v);
 }
 
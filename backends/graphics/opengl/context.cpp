@@ -38,6 +38,7 @@ void Context::reset() {
 	shadersSupported = false;
 	multitextureSupported = false;
 	framebufferObjectSupported = false;
+	unpackSubimageSupported = false;
 
 #define GL_FUNC_DEF(ret, name, param) name = nullptr;
 #include "backends/graphics/opengl/opengl-func.h"
@@ -138,6 +139,8 @@ void OpenGLGraphicsManager::initializeGLContext() {
 			g_context.multitextureSupported = true;
 		} else if (token == "GL_EXT_framebuffer_object") {
 			g_context.framebufferObjectSupported = true;
+		} else if (token == "GL_EXT_unpack_subimage") {
+			g_context.unpackSubimageSupported = true;
 		}
 	}
 
@@ -157,6 +160,12 @@ void OpenGLGraphicsManager::initializeGLContext() {
 		g_context.shadersSupported = ARBShaderObjects & ARBShadingLanguage100 & ARBVertexShader & ARBFragmentShader;
 	}
 
+	// Desktop GL always supports GL_UNPACK_ROW_LENGTH. GLES only supports it
+	// with GL_EXT_unpack_subimage.
+	if (g_context.type == kContextGL) {
+		g_context.unpackSubimageSupported = true;
+	}
+
 	// Log context type.
 	switch (g_context.type) {
 	case kContextGL:
@@ -177,6 +186,7 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	debug(5, "OpenGL: Shader support: %d", g_context.shadersSupported);
 	debug(5, "OpenGL: Multitexture support: %d", g_context.multitextureSupported);
 	debug(5, "OpenGL: FBO support: %d", g_context.framebufferObjectSupported);
+	debug(5, "OpenGL: Unpack subimage support: %d", g_context.unpackSubimageSupported);
 }
 
 } // End of namespace OpenGL
@@ -25,10 +25,12 @@
 #include "backends/graphics/opengl/texture.h"
 #include "backends/graphics/opengl/pipelines/pipeline.h"
 #include "backends/graphics/opengl/pipelines/fixed.h"
+#include "backends/graphics/opengl/pipelines/scaler.h"
 #include "backends/graphics/opengl/pipelines/shader.h"
 #include "backends/graphics/opengl/shader.h"
 
 #include "common/array.h"
+#include "common/debug.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/algorithm.h"
@@ -52,7 +54,7 @@ namespace OpenGL {
 
 OpenGLGraphicsManager::OpenGLGraphicsManager()
     : _currentState(), _oldState(), _transactionMode(kTransactionNone), _screenChangeID(1 << (sizeof(int) * 8 - 2)),
-      _pipeline(nullptr),
+      _pipeline(nullptr), _scalerPipeline(nullptr),
       _defaultFormat(), _defaultFormatAlpha(),
       _gameScreen(nullptr), _gameScreenShakeOffset(0), _overlay(nullptr),
       _cursor(nullptr),
@@ -147,6 +149,9 @@ namespace {
 
 const OSystem::GraphicsMode glGraphicsModes[] = {
 	{ "opengl",  _s("OpenGL"),                GFX_OPENGL  },
+	{ "opengl_advmame2x", _s("OpenGL AdvMAME2x"), GFX_OPENGL_ADVMAME2X },
+	{ "opengl_tv2x",      _s("OpenGL TV2x"),      GFX_OPENGL_TV2X      },
+	{ "opengl_dotmatrix", _s("OpenGL DotMatrix"), GFX_OPENGL_DOTMATRIX },
 	{ nullptr, nullptr, 0 }
 };
 
@@ -165,6 +170,9 @@ bool OpenGLGraphicsManager::setGraphicsMode(int mode) {
 
 	switch (mode) {
 	case GFX_OPENGL:
+	case GFX_OPENGL_ADVMAME2X:
+	case GFX_OPENGL_TV2X:
+	case GFX_OPENGL_DOTMATRIX:
 		_currentState.graphicsMode = mode;
 		return true;
 
@@ -312,6 +320,9 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 #endif
 	}
 
+	// Pick up graphics mode changes.
+	updateScalerPipeline();
+
 	// Update our display area and cursor scaling. This makes sure we pick up
 	// aspect ratio correction and game screen changes correctly.
 	recalculateDisplayAreas();
@@ -402,11 +413,13 @@ void OpenGLGraphicsManager::updateScreen() {
 	}
 
 	// Update changes to textures.
+	GLTexture::resetUploadedBytes();
 	_gameScreen->updateGLTexture();
 	if (_cursorVisible && _cursor) {
 		_cursor->updateGLTexture();
 	}
 	_overlay->updateGLTexture();
+	debug(9, "OpenGL: Uploaded %u bytes of texture data", GLTexture::getUploadedBytes());
 
 	// Clear the screen buffer.
 	GL_CALL(glClear(GL_COLOR_BUFFER_BIT));
@@ -420,8 +433,16 @@ void OpenGLGraphicsManager::updateScreen() {
 
 	const GLfloat shakeOffset = _gameScreenShakeOffset * (GLfloat)_gameDrawRect.height() / _gameScreen->getHeight();
 
-	// First step: Draw the (virtual) game screen.
+	// First step: Draw the (virtual) game screen. Scaler graphics modes use
+	// their own pipeline for this.
+	Pipeline *oldPipeline = nullptr;
+	if (_scalerPipeline) {
+		oldPipeline = g_context.setPipeline(_scalerPipeline);
+	}
 	g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
+	if (_scalerPipeline) {
+		g_context.setPipeline(oldPipeline);
+	}
 
 	// Second step: Draw the overlay if visible.
 	if (_overlayVisible) {
@@ -874,6 +895,8 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 
 	g_context.setPipeline(_pipeline);
 
+	updateScalerPipeline();
+
 	// Disable 3D properties.
 	GL_CALL(glDisable(GL_CULL_FACE));
 	GL_CALL(glDisable(GL_DEPTH_TEST));
@@ -964,11 +987,46 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 	g_context.setPipeline(nullptr);
 	delete _pipeline;
 	_pipeline = nullptr;
+	delete _scalerPipeline;
+	_scalerPipeline = nullptr;
 
 	// Rest our context description since the context is gone soon.
 	g_context.reset();
 }
 
+void OpenGLGraphicsManager::updateScalerPipeline() {
+	delete _scalerPipeline;
+	_scalerPipeline = nullptr;
+
+#if !USE_FORCED_GLES
+	if (!g_context.shadersSupported) {
+		return;
+	}
+
+	ShaderManager::ShaderUsage usage;
+	switch (_currentState.graphicsMode) {
+	case GFX_OPENGL_ADVMAME2X:
+		usage = ShaderManager::kAdvMame2x;
+		break;
+
+	case GFX_OPENGL_TV2X:
+		usage = ShaderManager::kTV2x;
+		break;
+
+	case GFX_OPENGL_DOTMATRIX:
+		usage = ShaderManager::kDotMatrix;
+		break;
+
+	default:
+		return;
+	}
+
+	_scalerPipeline = new ScalerPipeline(ShaderMan.query(usage));
+	_scalerPipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
+	_scalerPipeline->setFramebuffer(&_backBuffer);
+#endif
+}
+
 Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &format, bool wantAlpha) {
 	GLenum glIntFormat, glFormat, glType;
 	if (format.bytesPerPixel == 1) {
@@ -50,7 +50,10 @@ class Shader;
 #endif
 
 enum {
-	GFX_OPENGL = 0
+	GFX_OPENGL = 0,
+	GFX_OPENGL_ADVMAME2X = 1,
+	GFX_OPENGL_TV2X = 2,
+	GFX_OPENGL_DOTMATRIX = 3
 };
 
 class OpenGLGraphicsManager : virtual public WindowedGraphicsManager {
@@ -278,6 +281,18 @@ private:
 	 */
 	Pipeline *_pipeline;
 
+	/**
+	 * OpenGL pipeline used for drawing the game screen when a scaler
+	 * graphics mode is active. nullptr when no scaler is used or shaders
+	 * are not supported.
+	 */
+	Pipeline *_scalerPipeline;
+
+	/**
+	 * Set up _scalerPipeline according to the current graphics mode.
+	 */
+	void updateScalerPipeline();
+
 protected:
 	/**
 	 * Query the address of an OpenGL function by name.
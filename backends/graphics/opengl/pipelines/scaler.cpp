@@ -0,0 +1,50 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "backends/graphics/opengl/pipelines/scaler.h"
+#include "backends/graphics/opengl/shader.h"
+
+namespace OpenGL {
+
+#if !USE_FORCED_GLES
+ScalerPipeline::ScalerPipeline(Shader *shader)
+    : ShaderPipeline(shader), _textureWidth(0), _textureHeight(0), _sourceWidth(0), _sourceHeight(0) {
+}
+
+void ScalerPipeline::drawTexture(const GLTexture &texture, const GLfloat *coordinates) {
+	if (texture.getWidth() != _textureWidth || texture.getHeight() != _textureHeight) {
+		_textureWidth = texture.getWidth();
+		_textureHeight = texture.getHeight();
+		_activeShader->setUniform("textureSize", new ShaderUniformVec2(_textureWidth, _textureHeight));
+	}
+
+	if (texture.getLogicalWidth() != _sourceWidth || texture.getLogicalHeight() != _sourceHeight) {
+		_sourceWidth = texture.getLogicalWidth();
+		_sourceHeight = texture.getLogicalHeight();
+		_activeShader->setUniform("sourceSize", new ShaderUniformVec2(_sourceWidth, _sourceHeight));
+	}
+
+	ShaderPipeline::drawTexture(texture, coordinates);
+}
+#endif // !USE_FORCED_GLES
+
+} // End of namespace OpenGL
@@ -77,6 +77,102 @@ const char *const g_lookUpFragmentShader =
 	"\tgl_FragColor = blendColor * texture2D(palette, vec2(index.a * adjustFactor, 0.0));\n"
 	"}\n";
 
+// The scaler shaders below work on the source texels covered by a fragment
+// rather than on the output resolution. Every source texel is split into
+// 2x2 quadrants which get the same treatment the respective CPU scaler
+// applies to its 2x2 output block. This way the filters work for any output
+// size. 'textureSize' is the size of the texture in texels and 'sourceSize'
+// the size of the area actually used, neighbors are clamped to the latter.
+const char *const g_advMame2xFragmentShader =
+	"varying vec2 texCoord;\n"
+	"varying vec4 blendColor;\n"
+	"\n"
+	"uniform sampler2D texture;\n"
+	"uniform vec2 textureSize;\n"
+	"uniform vec2 sourceSize;\n"
+	"\n"
+	"vec4 fetch(vec2 texel) {\n"
+	"\treturn texture2D(texture, (clamp(texel, vec2(0.0), sourceSize - 1.0) + 0.5) / textureSize);\n"
+	"}\n"
+	"\n"
+	"bool same(vec4 a, vec4 b) {\n"
+	"\treturn all(lessThan(abs(a - b), vec4(1.0 / 512.0)));\n"
+	"}\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec2 dir = step(0.5, pos - texel) * 2.0 - 1.0;\n"
+	"\n"
+	"\tvec4 center = fetch(texel);\n"
+	"\tvec4 x = fetch(texel + vec2(dir.x, 0.0));\n"
+	"\tvec4 y = fetch(texel + vec2(0.0, dir.y));\n"
+	"\tvec4 xOpposite = fetch(texel - vec2(dir.x, 0.0));\n"
+	"\tvec4 yOpposite = fetch(texel - vec2(0.0, dir.y));\n"
+	"\n"
+	"\tvec4 color = center;\n"
+	"\tif (same(x, y) && !same(y, xOpposite) && !same(x, yOpposite)) {\n"
+	"\t\tcolor = x;\n"
+	"\t}\n"
+	"\tgl_FragColor = blendColor * color;\n"
+	"}\n";
+
+const char *const g_tv2xFragmentShader =
+	"varying vec2 texCoord;\n"
+	"varying vec4 blendColor;\n"
+	"\n"
+	"uniform sampler2D texture;\n"
+	"uniform vec2 textureSize;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec4 color = texture2D(texture, (texel + 0.5) / textureSize);\n"
+	"\tif (pos.y - texel.y >= 0.5) {\n"
+	"\t\tcolor.rgb *= 7.0 / 8.0;\n"
+	"\t}\n"
+	"\tgl_FragColor = blendColor * color;\n"
+	"}\n";
+
+const char *const g_dotMatrixFragmentShader =
+	"varying vec2 texCoord;\n"
+	"varying vec4 blendColor;\n"
+	"\n"
+	"uniform sampler2D texture;\n"
+	"uniform vec2 textureSize;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec4 color = texture2D(texture, (texel + 0.5) / textureSize);\n"
+	"\n"
+	"\t// Position inside the 4x4 dot pattern.\n"
+	"\tvec2 cell = mod(texel * 2.0 + step(0.5, pos - texel), 4.0);\n"
+	"\tvec3 mask = vec3(0.0);\n"
+	"\tif (cell.y < 0.5) {\n"
+	"\t\tif (cell.x < 0.5) {\n"
+	"\t\t\tmask = vec3(0.0, 1.0, 0.0);\n"
+	"\t\t} else if (cell.x < 1.5) {\n"
+	"\t\t\tmask = vec3(0.0, 0.0, 1.0);\n"
+	"\t\t} else if (cell.x < 2.5) {\n"
+	"\t\t\tmask = vec3(1.0, 0.0, 0.0);\n"
+	"\t\t}\n"
+	"\t} else if (cell.y > 1.5 && cell.y < 2.5) {\n"
+	"\t\tif (cell.x < 0.5) {\n"
+	"\t\t\tmask = vec3(1.0, 0.0, 0.0);\n"
+	"\t\t} else if (cell.x > 1.5 && cell.x < 2.5) {\n"
+	"\t\t\tmask = vec3(0.0, 1.0, 0.0);\n"
+	"\t\t} else if (cell.x > 2.5) {\n"
+	"\t\t\tmask = vec3(0.0, 0.0, 1.0);\n"
+	"\t\t}\n"
+	"\t} else if (cell.x < 0.5 || (cell.x > 1.5 && cell.x < 2.5)) {\n"
+	"\t\tmask = vec3(1.0);\n"
+	"\t}\n"
+	"\n"
+	"\tcolor.rgb -= color.rgb * mask * 0.25;\n"
+	"\tgl_FragColor = blendColor * color;\n"
+	"}\n";
+
 
 // Taken from: https://en.wikibooks.org/wiki/OpenGL_Programming/Modern_OpenGL_Tutorial_03#OpenGL_ES_2_portability
 const char *const g_precisionDefines =
@@ -104,6 +200,10 @@ void ShaderUniformFloat::set(GLint location) const {
 	GL_CALL(glUniform1f(location, _value));
 }
 
+void ShaderUniformVec2::set(GLint location) const {
+	GL_CALL(glUniform2f(location, _x, _y));
+}
+
 void ShaderUniformMatrix44::set(GLint location) const {
 	GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, _matrix));
 }
@@ -310,6 +410,9 @@ void ShaderManager::notifyCreate() {
 		_builtIn[kDefault] = new Shader(g_defaultVertexShader, g_defaultFragmentShader);
 		_builtIn[kCLUT8LookUp] = new Shader(g_defaultVertexShader, g_lookUpFragmentShader);
 		_builtIn[kCLUT8LookUp]->setUniform1I("palette", 1);
+		_builtIn[kAdvMame2x] = new Shader(g_defaultVertexShader, g_advMame2xFragmentShader);
+		_builtIn[kTV2x] = new Shader(g_defaultVertexShader, g_tv2xFragmentShader);
+		_builtIn[kDotMatrix] = new Shader(g_defaultVertexShader, g_dotMatrixFragmentShader);
 
 		for (uint i = 0; i < kMaxUsages; ++i) {
 			_builtIn[i]->setUniform1I("texture", 0);
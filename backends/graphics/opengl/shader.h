@@ -74,6 +74,19 @@ private:
 	const GLfloat _value;
 };
 
+/**
+ * 2D vector value for a shader uniform.
+ */
+class ShaderUniformVec2 : public ShaderUniformValue {
+public:
+	ShaderUniformVec2(GLfloat x, GLfloat y) : _x(x), _y(y) {}
+
+	virtual void set(GLint location) const override;
+
+private:
+	const GLfloat _x, _y;
+};
+
 /**
  * 4x4 Matrix value for a shader uniform.
  */
@@ -249,6 +262,15 @@ public:
 		/** CLUT8 look up shader. */
 		kCLUT8LookUp,
 
+		/** AdvMAME2x (Scale2x) edge interpolation filter. */
+		kAdvMame2x,
+
+		/** TV2x scan line filter. */
+		kTV2x,
+
+		/** DotMatrix filter. */
+		kDotMatrix,
+
 		/** Number of built-in shaders. Should not be used for query. */
 		kMaxUsages
 	};
@@ -44,6 +44,8 @@ static GLuint nextHigher2(GLuint v) {
 }
 
 
+uint GLTexture::_uploadedBytes = 0;
+
 GLTexture::GLTexture(GLenum glIntFormat, GLenum glFormat, GLenum glType)
     : _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType),
       _width(0), _height(0), _logicalWidth(0), _logicalHeight(0),
@@ -146,26 +148,41 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	// Set the texture on the active texture unit.
 	bind();
 
+	const uint bytesPerPixel = src.format.bytesPerPixel;
+	const uint rowSize = area.width() * bytesPerPixel;
+
 	// Update the actual texture.
-	// Although we have the area of the texture buffer we want to update we
-	// cannot take advantage of the left/right boundries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
-	//
-	// 1) (As we do right now) Simply always update the whole texture lines of
-	//    rect changed. This is simplest to implement. In case performance is
-	//    really an issue we can think of switching to another method.
-	//
-	// 2) Copy the dirty rect to a temporary buffer and upload that by using
-	//    glTexSubImage2D. This is what the Android backend does. It is more
-	//    complicated though.
-	//
-	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
-	//    graphics manager did but it is much slower! Thus, we do not use it.
-	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
-	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
+	// glTexSubImage2D has no pitch parameter. When whole texture lines are
+	// updated the source data is contiguous and can be uploaded directly.
+	// Otherwise, we set GL_UNPACK_ROW_LENGTH when the context supports it.
+	// OpenGL ES only supports it with GL_EXT_unpack_subimage, thus we copy
+	// the area to a staging buffer and upload that in case it is missing.
+	// Uploading whole texture lines instead would re-upload most of the
+	// texture for small changes in opposite corners.
+	if (area.left == 0 && area.width() == src.w && src.pitch == rowSize) {
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
+		                        _glFormat, _glType, src.getBasePtr(0, area.top)));
+	} else if (g_context.unpackSubimageSupported) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+	} else {
+		_stagingBuffer.resize(rowSize * area.height());
+
+		const byte *srcRow = (const byte *)src.getBasePtr(area.left, area.top);
+		byte *dstRow = _stagingBuffer.begin();
+		for (int y = area.height(); y > 0; --y) {
+			memcpy(dstRow, srcRow, rowSize);
+			srcRow += src.pitch;
+			dstRow += rowSize;
+		}
+
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, _stagingBuffer.begin()));
+	}
+
+	_uploadedBytes += rowSize * area.height();
 }
 
 //
@@ -173,7 +190,7 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 //
 
 Surface::Surface()
-    : _allDirty(false), _dirtyArea() {
+    : _allDirty(false), _dirtyRects() {
 }
 
 void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
@@ -181,15 +198,7 @@ void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcP
 	assert(x + w <= dstSurf->w);
 	assert(y + h <= dstSurf->h);
 
-	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
-	// parameters is an empty rect. Thus, we check whether the current dirty
-	// area is valid. In case it is not we simply use the parameters as new
-	// dirty area. Otherwise, we simply call extend.
-	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = Common::Rect(x, y, x + w, y + h);
-	} else {
-		_dirtyArea.extend(Common::Rect(x, y, x + w, y + h));
-	}
+	addDirtyArea(Common::Rect(x, y, x + w, y + h));
 
 	const byte *src = (const byte *)srcPtr;
 	byte *dst = (byte *)dstSurf->getBasePtr(x, y);
@@ -217,8 +226,73 @@ void Surface::fill(uint32 color) {
 Common::Rect Surface::getDirtyArea() const {
 	if (_allDirty) {
 		return Common::Rect(getWidth(), getHeight());
-	} else {
-		return _dirtyArea;
+	}
+
+	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
+	// parameters is an empty rect. Thus, we start with the first rect and
+	// extend from there.
+	Common::Rect area;
+	for (DirtyRectList::const_iterator i = _dirtyRects.begin(), end = _dirtyRects.end(); i != end; ++i) {
+		if (area.isEmpty()) {
+			area = *i;
+		} else {
+			area.extend(*i);
+		}
+	}
+	return area;
+}
+
+Surface::DirtyRectList Surface::getDirtyRects() const {
+	if (_allDirty) {
+		DirtyRectList rects;
+		rects.push_back(Common::Rect(getWidth(), getHeight()));
+		return rects;
+	}
+
+	return _dirtyRects;
+}
+
+namespace {
+/** Maximum number of separate dirty rects tracked per surface. */
+const uint kMaxDirtyRects = 16;
+
+inline uint rectArea(const Common::Rect &r) {
+	return r.width() * r.height();
+}
+} // End of anonymous namespace
+
+void Surface::addDirtyArea(const Common::Rect &newArea) {
+	if (_allDirty || newArea.isEmpty()) {
+		return;
+	}
+
+	// Merge the new area with every rect it overlaps, and with those rects
+	// for which the merged rect is not much larger than both of them
+	// together. The latter avoids many tiny uploads for neighboring changes.
+	// Merging grows the area, thus we restart the search after each merge.
+	Common::Rect area = newArea;
+	for (uint i = 0; i < _dirtyRects.size();) {
+		Common::Rect merged = area;
+		merged.extend(_dirtyRects[i]);
+
+		const uint separateArea = rectArea(area) + rectArea(_dirtyRects[i]);
+		if (area.intersects(_dirtyRects[i]) || rectArea(merged) <= separateArea + separateArea / 4) {
+			area = merged;
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	_dirtyRects.push_back(area);
+
+	// Fall back to a single bounding rect in case there are too many separate
+	// areas. Many small uploads are slower than a bigger one.
+	if (_dirtyRects.size() > kMaxDirtyRects) {
+		area = getDirtyArea();
+		_dirtyRects.clear();
+		_dirtyRects.push_back(area);
 	}
 }
 
@@ -279,8 +353,16 @@ void Texture::updateGLTexture() {
 		return;
 	}
 
-	Common::Rect dirtyArea = getDirtyArea();
+	const DirtyRectList dirtyRects = getDirtyRects();
+	for (DirtyRectList::const_iterator i = dirtyRects.begin(), end = dirtyRects.end(); i != end; ++i) {
+		updateArea(*i);
+	}
+
+	// We should have handled everything, thus not dirty anymore.
+	clearDirty();
+}
 
+void Texture::updateArea(Common::Rect dirtyArea) {
 	// In case we use linear filtering we might need to duplicate the last
 	// pixel row/column to avoid glitches with filtering.
 	if (_glTexture.isLinearFilteringEnabled()) {
@@ -311,9 +393,6 @@ void Texture::updateGLTexture() {
 	}
 
 	_glTexture.updateArea(dirtyArea, _textureData);
-
-	// We should have handled everything, thus not dirty anymore.
-	clearDirty();
 }
 
 TextureCLUT8::TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
@@ -410,20 +489,24 @@ void TextureCLUT8::updateGLTexture() {
 	// Do the palette look up
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	Common::Rect dirtyArea = getDirtyArea();
-
-	if (outSurf->format.bytesPerPixel == 2) {
-		doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
-	} else if (outSurf->format.bytesPerPixel == 4) {
-		doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
-	} else {
-		warning("TextureCLUT8::updateTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+	const DirtyRectList dirtyRects = getDirtyRects();
+	for (DirtyRectList::const_iterator i = dirtyRects.begin(), end = dirtyRects.end(); i != end; ++i) {
+		const Common::Rect &dirtyArea = *i;
+
+		if (outSurf->format.bytesPerPixel == 2) {
+			doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
+		} else if (outSurf->format.bytesPerPixel == 4) {
+			doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
+		} else {
+			warning("TextureCLUT8::updateTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+			break;
+		}
 	}
 
 	// Do generic handling of updating the texture.
@@ -609,7 +692,10 @@ void TextureCLUT8GPU::updateGLTexture() {
 
 	// Update CLUT8 texture if necessary.
 	if (Surface::isDirty()) {
-		_clut8Texture.updateArea(getDirtyArea(), _clut8Data);
+		const DirtyRectList dirtyRects = getDirtyRects();
+		for (DirtyRectList::const_iterator i = dirtyRects.begin(), end = dirtyRects.end(); i != end; ++i) {
+			_clut8Texture.updateArea(*i, _clut8Data);
+		}
 		clearDirty();
 	}
 
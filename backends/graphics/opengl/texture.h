@@ -28,6 +28,7 @@
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace OpenGL {
@@ -99,6 +100,17 @@ public:
 	 */
 	void updateArea(const Common::Rect &area, const Graphics::Surface &src);
 
+	/**
+	 * Query the number of bytes uploaded by all textures since the last call
+	 * to resetUploadedBytes.
+	 */
+	static uint getUploadedBytes() { return _uploadedBytes; }
+
+	/**
+	 * Reset the uploaded bytes counter.
+	 */
+	static void resetUploadedBytes() { _uploadedBytes = 0; }
+
 	/**
 	 * Query the GL texture's width.
 	 */
@@ -143,6 +155,14 @@ private:
 	GLint _glFilter;
 
 	GLuint _glTexture;
+
+	/**
+	 * Buffer used to pack partial rows for upload when GL_UNPACK_ROW_LENGTH
+	 * is not available.
+	 */
+	Common::Array<byte> _stagingBuffer;
+
+	static uint _uploadedBytes;
 };
 
 /**
@@ -201,7 +221,7 @@ public:
 	void fill(uint32 color);
 
 	void flagDirty() { _allDirty = true; }
-	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
+	virtual bool isDirty() const { return _allDirty || !_dirtyRects.empty(); }
 
 	virtual uint getWidth() const = 0;
 	virtual uint getHeight() const = 0;
@@ -239,12 +259,31 @@ public:
 	 */
 	virtual const GLTexture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	typedef Common::Array<Common::Rect> DirtyRectList;
+
+	void clearDirty() { _allDirty = false; _dirtyRects.clear(); }
 
+	/**
+	 * @return The bounding rectangle of all dirty areas.
+	 */
 	Common::Rect getDirtyArea() const;
+
+	/**
+	 * @return All dirty areas. These do not overlap.
+	 */
+	DirtyRectList getDirtyRects() const;
 private:
+	/**
+	 * Add an area to the dirty rect list.
+	 *
+	 * Areas are merged with existing ones when this does not add much
+	 * unchanged data to the upload. When the list grows too long it is
+	 * replaced by its bounding rectangle.
+	 */
+	void addDirtyArea(const Common::Rect &area);
+
 	bool _allDirty;
-	Common::Rect _dirtyArea;
+	DirtyRectList _dirtyRects;
 };
 
 /**
@@ -289,6 +328,8 @@ protected:
 	const Graphics::PixelFormat _format;
 
 private:
+	void updateArea(Common::Rect area);
+
 	GLTexture _glTexture;
 
 	Graphics::Surface _textureData;
@@ -128,6 +128,7 @@ MODULE_OBJS += \
 	graphics/opengl/pipelines/clut8.o \
 	graphics/opengl/pipelines/fixed.o \
 	graphics/opengl/pipelines/pipeline.o \
+	graphics/opengl/pipelines/scaler.o \
 	graphics/opengl/pipelines/shader.o
 endif
 
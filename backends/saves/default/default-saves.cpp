@@ -168,7 +168,10 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 
 	// Open the file for saving.
 	Common::WriteStream *const sf = fileNode.createWriteStream();
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	// Saving can optionally use a faster compression level, at the cost of
+	// larger savegames.
+	const bool fastCompression = ConfMan.getBool("fast_save_compression");
+	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf, fastCompression) : sf);
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
@@ -233,8 +233,10 @@ void registerDefaults() {
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
+	ConfMan.registerDefault("mt32_render_ahead", 0);
 	ConfMan.registerDefault("gm_device", "null");
 	ConfMan.registerDefault("opl2lpt_parport", "null");
+	ConfMan.registerDefault("opl_render_ahead", 0);
 
 	ConfMan.registerDefault("cdrom", 0);
 
@@ -249,6 +251,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("dump_scripts", false);
 	ConfMan.registerDefault("save_slot", -1);
 	ConfMan.registerDefault("autosave_period", 5 * 60); // By default, trigger autosave every 5 minutes
+	ConfMan.registerDefault("fast_save_compression", false);
 
 #if defined(ENABLE_SCUMM) || defined(ENABLE_SWORD2)
 	ConfMan.registerDefault("object_labels", true);
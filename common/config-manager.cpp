@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -52,7 +53,7 @@ char const *const ConfigManager::kCloudDomain = "cloud";
 #pragma mark -
 
 
-ConfigManager::ConfigManager() : _activeDomain(nullptr) {
+ConfigManager::ConfigManager() : _activeDomain(nullptr), _flushedConfigValid(false) {
 }
 
 void ConfigManager::defragment() {
@@ -78,6 +79,8 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	_flushedConfig = source._flushedConfig;
+	_flushedConfigValid = source._flushedConfigValid;
 }
 
 
@@ -97,6 +100,7 @@ void ConfigManager::loadDefaultConfigFile() {
 	} else {
 		// No config file -> create new one!
 		debug("Default configuration file missing, creating a new one");
+		_flushedConfigValid = false;
 
 		flushToDisk();
 	}
@@ -108,6 +112,7 @@ void ConfigManager::loadConfigFile(const String &filename) {
 	FSNode node(filename);
 	File cfg_file;
 	if (!cfg_file.open(node)) {
+		_flushedConfigValid = false;
 		debug("Creating configuration file: %s", filename.c_str());
 	} else {
 		debug("Using configuration file: %s", _filename.c_str());
@@ -178,13 +183,32 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	// TODO: Detect if a domain occurs multiple times (or likewise, if
 	// a key occurs multiple times inside one domain).
 
-	while (!stream.eos() && !stream.err()) {
-		lineno++;
+	const uint32 startTime = g_system ? g_system->getMillis() : 0;
+
+	// Read the whole file in one go and split it into lines in place,
+	// instead of fetching it byte by byte through readLine().
+	const int32 size = MAX<int32>(stream.size() - stream.pos(), 0);
+	char *buffer = new char[size + 1];
+	const uint32 bufferSize = stream.read(buffer, size);
+	buffer[bufferSize] = 0;
 
-		// Read a line
-		String line = stream.readLine();
+	char *next = buffer;
+	char *const bufferEnd = buffer + bufferSize;
+	while (next < bufferEnd) {
+		lineno++;
 
-		if (line.size() == 0) {
+		// Find the end of the line. Like readLine(), accept LF, CR and
+		// CR/LF line endings.
+		char *line = next;
+		char *eol = line;
+		while (eol < bufferEnd && *eol != '\n' && *eol != '\r')
+			eol++;
+		next = eol + 1;
+		if (eol < bufferEnd && *eol == '\r' && next < bufferEnd && *next == '\n')
+			next++;
+		*eol = 0;
+
+		if (*line == 0) {
 			// Do nothing
 		} else if (line[0] == '#') {
 			// Accumulate comments here. Once we encounter either the start
@@ -197,7 +221,7 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			// Determine where the previously accumulated domain goes, if we accumulated anything.
 			addDomain(domainName, domain);
 			domain.clear();
-			const char *p = line.c_str() + 1;
+			const char *p = line + 1;
 			// Get the domain name, and check whether it's valid (that
 			// is, verify that it only consists of alphanumerics,
 			// dashes and underscores).
@@ -209,7 +233,7 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			else if (*p != ']')
 				error("Config file buggy: Invalid character '%c' occurred in section name in line %d", *p, lineno);
 
-			domainName = String(line.c_str() + 1, p);
+			domainName = String(line + 1, p);
 
 			domain.setDomainComment(comment);
 			comment.clear();
@@ -218,7 +242,7 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			// This line should be a line with a 'key=value' pair, or an empty one.
 
 			// Skip leading whitespaces
-			const char *t = line.c_str();
+			const char *t = line;
 			while (isSpace(*t))
 				t++;
 
@@ -248,16 +272,47 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			domain[key] = value;
 
 			// Store comment
-			domain.setKVComment(key, comment);
-			comment.clear();
+			if (!comment.empty()) {
+				domain.setKVComment(key, comment);
+				comment.clear();
+			}
 		}
 	}
 
+	delete[] buffer;
+
 	addDomain(domainName, domain); // Add the last domain found
+
+	rememberFlushedConfig();
+
+	if (g_system)
+		debug(5, "ConfigManager: Loaded %d lines (%d bytes) in %d ms", lineno, bufferSize, g_system->getMillis() - startTime);
+}
+
+void ConfigManager::rememberFlushedConfig() {
+	MemoryWriteStreamDynamic config(DisposeAfterUse::YES);
+	writeConfig(config);
+	_flushedConfig = String((const char *)config.getData(), config.size());
+	_flushedConfigValid = true;
 }
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	// Serialize the configuration into memory first. If it matches what
+	// was last loaded or written, there is nothing to do; otherwise the
+	// file is written out in a single call.
+	const uint32 startTime = g_system ? g_system->getMillis() : 0;
+
+	MemoryWriteStreamDynamic config(DisposeAfterUse::YES);
+	writeConfig(config);
+
+	if (_flushedConfigValid && config.size() == _flushedConfig.size() &&
+	        !memcmp(config.getData(), _flushedConfig.c_str(), config.size())) {
+		if (g_system)
+			debug(5, "ConfigManager: Configuration unchanged, not flushing (checked in %d ms)", g_system->getMillis() - startTime);
+		return;
+	}
+
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -279,44 +334,61 @@ void ConfigManager::flushToDisk() {
 		stream = dump;
 	}
 
+	stream->write(config.getData(), config.size());
+	bool success = stream->flush() && !stream->err();
+	delete stream;
+
+	if (success) {
+		_flushedConfig = String((const char *)config.getData(), config.size());
+		_flushedConfigValid = true;
+
+		if (g_system)
+			debug(5, "ConfigManager: Flushed %d bytes in %d ms", config.size(), g_system->getMillis() - startTime);
+	} else {
+		warning("Unable to write configuration file");
+		_flushedConfigValid = false;
+	}
+#endif // !__DC__
+}
+
+void ConfigManager::writeConfig(WriteStream &stream) {
 	// Write the application domain
-	writeDomain(*stream, kApplicationDomain, _appDomain);
+	writeDomain(stream, kApplicationDomain, _appDomain);
 
 #ifdef ENABLE_KEYMAPPER
 	// Write the keymapper domain
-	writeDomain(*stream, kKeymapperDomain, _keymapperDomain);
+	writeDomain(stream, kKeymapperDomain, _keymapperDomain);
 #endif
 #ifdef USE_CLOUD
 	// Write the cloud domain
-	writeDomain(*stream, kCloudDomain, _cloudDomain);
+	writeDomain(stream, kCloudDomain, _cloudDomain);
 #endif
 
 	DomainMap::const_iterator d;
 
 	// Write the miscellaneous domains next
 	for (d = _miscDomains.begin(); d != _miscDomains.end(); ++d) {
-		writeDomain(*stream, d->_key, d->_value);
+		writeDomain(stream, d->_key, d->_value);
 	}
 
 	// First write the domains in _domainSaveOrder, in that order.
 	// Note: It's possible for _domainSaveOrder to list domains which
 	// are not present anymore, so we validate each name.
+	HashMap<String, bool> savedDomains;
 	Array<String>::const_iterator i;
 	for (i = _domainSaveOrder.begin(); i != _domainSaveOrder.end(); ++i) {
-		if (_gameDomains.contains(*i)) {
-			writeDomain(*stream, *i, _gameDomains[*i]);
+		savedDomains[*i] = true;
+		DomainMap::const_iterator domain = _gameDomains.find(*i);
+		if (domain != _gameDomains.end()) {
+			writeDomain(stream, *i, domain->_value);
 		}
 	}
 
 	// Now write the domains which haven't been written yet
 	for (d = _gameDomains.begin(); d != _gameDomains.end(); ++d) {
-		if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), d->_key) == _domainSaveOrder.end())
-			writeDomain(*stream, d->_key, d->_value);
+		if (!savedDomains.contains(d->_key))
+			writeDomain(stream, d->_key, d->_value);
 	}
-
-	delete stream;
-
-#endif // !__DC__
 }
 
 void ConfigManager::writeDomain(WriteStream &stream, const String &name, const Domain &domain) {
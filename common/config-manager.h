@@ -181,6 +181,8 @@ private:
 	void			loadFromStream(SeekableReadStream &stream);
 	void			addDomain(const String &domainName, const Domain &domain);
 	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
+	void			writeConfig(WriteStream &stream);
+	void			rememberFlushedConfig();
 	void			renameDomain(const String &oldName, const String &newName, DomainMap &map);
 
 	Domain			_transientDomain;
@@ -203,6 +205,13 @@ private:
 	Domain *		_activeDomain;
 
 	String			_filename;
+
+	/**
+	 * Serialized contents of the config file as last loaded or written.
+	 * Used by flushToDisk() to skip rewriting an unchanged file.
+	 */
+	String			_flushedConfig;
+	bool			_flushedConfigValid;
 };
 
 } // End of namespace Common
@@ -29,6 +29,16 @@
 namespace Common {
 
 MemoryPool *g_refCountPool = nullptr; // FIXME: This is never freed right now
+StringAllocationStats g_stringAllocationStats = { 0, 0 };
+
+StringAllocationStats getStringAllocationStats() {
+	return g_stringAllocationStats;
+}
+
+void resetStringAllocationStats() {
+	g_stringAllocationStats.allocations = 0;
+	g_stringAllocationStats.bytes = 0;
+}
 
 static uint32 computeCapacity(uint32 len) {
 	// By default, for the capacity we use the next multiple of 32
@@ -67,6 +77,9 @@ void String::initWithCStr(const char *str, uint32 len) {
 		_extern._refCount = nullptr;
 		_str = new char[_extern._capacity];
 		assert(_str != nullptr);
+
+		g_stringAllocationStats.allocations++;
+		g_stringAllocationStats.bytes += _extern._capacity;
 	}
 
 	// Copy the string into the storage area
@@ -132,19 +145,27 @@ void String::ensureCapacity(uint32 new_size, bool keep_old) {
 	if (!isShared && new_size < curCapacity)
 		return;
 
-	// We need to allocate storage on the heap!
+	if (isShared && new_size < _builtinCapacity && (!keep_old || _size < _builtinCapacity)) {
+		// We share the storage, but there is enough internal storage: Use that.
+		newStorage = _storage;
+		newCapacity = _builtinCapacity;
+	} else {
+		// We need to allocate storage on the heap!
 
-	// Compute a suitable new capacity limit
-	// If the current capacity is sufficient we use the same capacity
-	if (new_size < curCapacity)
-		newCapacity = curCapacity;
-	else
-		newCapacity = MAX(curCapacity * 2, computeCapacity(new_size+1));
+		// Compute a suitable new capacity limit
+		// If the current capacity is sufficient we use the same capacity
+		if (new_size < curCapacity)
+			newCapacity = curCapacity;
+		else
+			newCapacity = MAX(curCapacity * 2, computeCapacity(new_size+1));
 
-	// Allocate new storage
-	newStorage = new char[newCapacity];
-	assert(newStorage);
+		// Allocate new storage
+		newStorage = new char[newCapacity];
+		assert(newStorage);
 
+		g_stringAllocationStats.allocations++;
+		g_stringAllocationStats.bytes += newCapacity;
+	}
 
 	// Copy old data if needed, elsewise reset the new storage.
 	if (keep_old) {
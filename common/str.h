@@ -29,6 +29,22 @@
 
 namespace Common {
 
+/**
+ * Counters for the heap allocations made to hold the contents of String
+ * and U32String objects. Strings which fit into the builtin storage do
+ * not allocate and are not counted.
+ */
+struct StringAllocationStats {
+	uint32 allocations; ///< Number of storage blocks allocated
+	uint32 bytes;       ///< Total size of the allocated blocks
+};
+
+/** Return the string allocation counters accumulated since the last reset. */
+StringAllocationStats getStringAllocationStats();
+
+/** Reset the string allocation counters. */
+void resetStringAllocationStats();
+
 /**
  * Simple string class for ScummVM. Provides automatic storage managment,
  * and overloads several operators in a 'natural' fashion, mimicking
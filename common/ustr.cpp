@@ -22,11 +22,13 @@
 
 #include "common/ustr.h"
 #include "common/memorypool.h"
+#include "common/str.h"
 #include "common/util.h"
 
 namespace Common {
 
 extern MemoryPool *g_refCountPool;
+extern StringAllocationStats g_stringAllocationStats;
 
 static uint32 computeCapacity(uint32 len) {
 	// By default, for the capacity we use the next multiple of 32
@@ -244,6 +246,9 @@ void U32String::ensureCapacity(uint32 new_size, bool keep_old) {
 		// Allocate new storage
 		newStorage = new value_type[newCapacity];
 		assert(newStorage);
+
+		g_stringAllocationStats.allocations++;
+		g_stringAllocationStats.bytes += newCapacity * sizeof(value_type);
 	}
 
 	// Copy old data if needed, elsewise reset the new storage.
@@ -320,6 +325,9 @@ void U32String::initWithCStr(const value_type *str, uint32 len) {
 		_extern._refCount = nullptr;
 		_str = new value_type[_extern._capacity];
 		assert(_str != nullptr);
+
+		g_stringAllocationStats.allocations++;
+		g_stringAllocationStats.bytes += _extern._capacity * sizeof(value_type);
 	}
 
 	// Copy the string into the storage area
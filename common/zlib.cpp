@@ -28,6 +28,7 @@
 #include "common/util.h"
 #include "common/stream.h"
 #include "common/debug.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #if defined(USE_ZLIB)
@@ -318,8 +319,17 @@ protected:
 	int _zlibErr;
 	uint32 _pos;
 
+	// Small writes are collected here and handed to zlib in one go, as
+	// calling deflate() for every few bytes is very slow.
+	byte	_inBuf[BUFSIZE];
+	uint32	_inBufSize;
+
+	// Time spent compressing, reported when the stream is finalized
+	uint32	_compressTime;
+
 	void processData(int flushType) {
 		// This function is called by both write() and finalize().
+		const uint32 startTime = g_system ? g_system->getMillis() : 0;
 		while (_zlibErr == Z_OK && (_stream.avail_in || flushType == Z_FINISH)) {
 			if (_stream.avail_out == 0) {
 				if (_wrapped->write(_buf, BUFSIZE) != BUFSIZE) {
@@ -331,10 +341,19 @@ protected:
 			}
 			_zlibErr = deflate(&_stream, flushType);
 		}
+		if (g_system)
+			_compressTime += g_system->getMillis() - startTime;
+	}
+
+	void processInputBuffer(int flushType) {
+		_stream.next_in = _inBuf;
+		_stream.avail_in = _inBufSize;
+		processData(flushType);
+		_inBufSize = 0;
 	}
 
 public:
-	GZipWriteStream(WriteStream *w) : _wrapped(w), _stream(), _pos(0) {
+	GZipWriteStream(WriteStream *w, bool fast) : _wrapped(w), _stream(), _pos(0), _inBufSize(0), _compressTime(0) {
 		assert(w != nullptr);
 
 		// Adding 16 to windowBits indicates to zlib that it is supposed to
@@ -342,7 +361,7 @@ public:
 		// released 10 August 2003.
 		// Note: This is *crucial* for savegame compatibility, do *not* remove!
 		_zlibErr = deflateInit2(&_stream,
-		                 Z_DEFAULT_COMPRESSION,
+		                 fast ? Z_BEST_SPEED : Z_DEFAULT_COMPRESSION,
 		                 Z_DEFLATED,
 		                 MAX_WBITS + 16,
 		                 8,
@@ -376,7 +395,7 @@ public:
 			return;
 
 		// Process whatever remaining data there is.
-		processData(Z_FINISH);
+		processInputBuffer(Z_FINISH);
 
 		// Since processData only writes out blocks of size BUFSIZE,
 		// we may have to flush some stragglers.
@@ -389,12 +408,34 @@ public:
 
 		// Finalize the wrapped savefile, too
 		_wrapped->finalize();
+
+		debug(5, "GZipWriteStream: Compressed %u bytes into %u bytes in %u ms", _pos, (uint32)_stream.total_out, _compressTime);
 	}
 
 	uint32 write(const void *dataPtr, uint32 dataSize) {
 		if (err())
 			return 0;
 
+		// Collect small writes in the input buffer
+		if (_inBufSize + dataSize <= BUFSIZE) {
+			memcpy(_inBuf + _inBufSize, dataPtr, dataSize);
+			_inBufSize += dataSize;
+			_pos += dataSize;
+			return dataSize;
+		}
+
+		// The buffer is full, compress its contents first
+		processInputBuffer(Z_NO_FLUSH);
+		if (err())
+			return 0;
+
+		if (dataSize < BUFSIZE) {
+			memcpy(_inBuf, dataPtr, dataSize);
+			_inBufSize = dataSize;
+			_pos += dataSize;
+			return dataSize;
+		}
+
 		// Hook in the new data ...
 		// Note: We need to make a const_cast here, as zlib is not aware
 		// of the const keyword.
@@ -432,10 +473,10 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
 	return toBeWrapped;
 }
 
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped) {
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, bool fast) {
 #if defined(USE_ZLIB)
 	if (toBeWrapped)
-		return new GZipWriteStream(toBeWrapped);
+		return new GZipWriteStream(toBeWrapped, fast);
 #endif
 	return toBeWrapped;
 }
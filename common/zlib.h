@@ -130,8 +130,12 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
  *
  * It is safe to call this with a NULL parameter (in this case, NULL is
  * returned).
+ *
+ * If fast is true, the fastest zlib compression level is used instead of
+ * the default one. This trades a somewhat larger output for a much lower
+ * CPU cost; the data can still be read by wrapCompressedReadStream().
  */
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped);
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, bool fast = false);
 
 } // End of namespace Common
 
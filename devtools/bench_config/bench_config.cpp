@@ -0,0 +1,225 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * This is a utility which measures how long the ConfigManager takes to
+ * load and flush a large config file. It generates a config file with the
+ * given number of game domains and times loading it, flushing it unchanged
+ * and flushing it after a change.
+ */
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+// HACK to allow building with the SDL backend on MinGW
+// see bug #1800764 "TOOLS: MinGW tools building broken"
+#ifdef main
+#undef main
+#endif // main
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/scummsys.h"
+#include "common/config-manager.h"
+#include "common/memstream.h"
+#include "common/str.h"
+#include "common/system.h"
+
+/**
+ * Discards everything written to it, but keeps count of the bytes.
+ */
+class CountingWriteStream : public Common::WriteStream {
+public:
+	CountingWriteStream(uint32 &count) : _count(count) { _count = 0; }
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		_count += dataSize;
+		return dataSize;
+	}
+
+	int32 pos() const { return _count; }
+
+private:
+	uint32 &_count;
+};
+
+/**
+ * A minimal backend. The config file is read from and written to memory
+ * instead of the disk, so only parsing and serializing are measured.
+ */
+class NullSystem : public OSystem {
+public:
+	const GraphicsMode *getSupportedGraphicsModes() const { return s_noGraphicsModes; }
+	int getDefaultGraphicsMode() const { return 0; }
+	bool setGraphicsMode(int mode) { return false; }
+	int getGraphicsMode() const { return 0; }
+#ifdef USE_RGB_COLOR
+	Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+#endif
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format) {}
+	int16 getHeight() { return 0; }
+	int16 getWidth() { return 0; }
+	PaletteManager *getPaletteManager() { return 0; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	Graphics::Surface *lockScreen() { return 0; }
+	void unlockScreen() {}
+	void fillScreen(uint32 col) {}
+	void updateScreen() {}
+	void setShakePos(int shakeOffset) {}
+	void showOverlay() {}
+	void hideOverlay() {}
+	Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	void clearOverlay() {}
+	void grabOverlay(void *buf, int pitch) {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	int16 getOverlayHeight() { return 0; }
+	int16 getOverlayWidth() { return 0; }
+	bool showMouse(bool visible) { return false; }
+	void warpMouse(int x, int y) {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) {}
+	uint32 getMillis(bool skipRecord) { return (uint32)((uint64)clock() * 1000 / CLOCKS_PER_SEC); }
+	void delayMillis(uint msecs) {}
+	void getTimeAndDate(TimeDate &t) const { memset(&t, 0, sizeof(t)); }
+	MutexRef createMutex() { return 0; }
+	void lockMutex(MutexRef mutex) {}
+	void unlockMutex(MutexRef mutex) {}
+	void deleteMutex(MutexRef mutex) {}
+	Audio::Mixer *getMixer() { return 0; }
+	void quit() { exit(0); }
+	void displayMessageOnOSD(const char *msg) {}
+	void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
+	void logMessage(LogMessageType::Type type, const char *message) { fputs(message, stderr); }
+
+	Common::SeekableReadStream *createConfigReadStream() {
+		return new Common::MemoryReadStream((const byte *)_config.c_str(), _config.size());
+	}
+	Common::WriteStream *createConfigWriteStream() { return new CountingWriteStream(_writtenBytes); }
+
+	Common::String _config;
+	uint32 _writtenBytes;
+
+private:
+	static const GraphicsMode s_noGraphicsModes[];
+};
+
+const OSystem::GraphicsMode NullSystem::s_noGraphicsModes[] = { { 0, 0, 0 } };
+
+/**
+ * Generates a config file resembling one of a big game collection.
+ */
+static Common::String generateConfig(int domains) {
+	Common::String config = "[scummvm]\n"
+		"gfx_mode=2x\n"
+		"fullscreen=false\n"
+		"music_volume=192\n"
+		"sfx_volume=192\n"
+		"speech_volume=192\n"
+		"subtitles=true\n"
+		"lastselectedgame=game00000\n"
+		"versioninfo=2.1.0git\n"
+		"\n";
+
+	for (int i = 0; i < domains; i++) {
+		if (i % 10 == 0)
+			config += Common::String::format("# Added by the mass add dialog\n");
+
+		config += Common::String::format("[game%05d]\n"
+			"gameid=game%d\n"
+			"description=Some Adventure Game %d (CD/DOS/English)\n"
+			"path=/home/user/games/collection/some-adventure-game-%d\n"
+			"language=en\n"
+			"platform=pc\n"
+			"extra=CD\n"
+			"music_volume=%d\n"
+			"sfx_volume=%d\n"
+			"speech_volume=%d\n"
+			"subtitles=true\n"
+			"talkspeed=60\n"
+			"save_slot=%d\n"
+			"\n", i, i % 300, i, i, i % 256, (i * 7) % 256, (i * 13) % 256, i % 100);
+	}
+
+	return config;
+}
+
+static double elapsedMillis(clock_t start) {
+	return (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc > 3) {
+		printf("Usage: %s [domains] [runs]\n", argv[0]);
+		printf("Measures loading and flushing a config file with the given number of game domains.\n");
+		return -1;
+	}
+
+	const int domains = argc > 1 ? atoi(argv[1]) : 10000;
+	const int runs = argc > 2 ? atoi(argv[2]) : 5;
+	if (domains <= 0 || runs <= 0) {
+		fprintf(stderr, "Invalid arguments\n");
+		return -1;
+	}
+
+	NullSystem system;
+	g_system = &system;
+
+	system._config = generateConfig(domains);
+	printf("%d game domains, %d bytes, best of %d runs\n\n", domains, system._config.size(), runs);
+
+	double loadTime = 0, unchangedFlushTime = 0, changedFlushTime = 0;
+	uint32 unchangedBytes = 0, changedBytes = 0;
+
+	for (int i = 0; i < runs; i++) {
+		clock_t start = clock();
+		ConfMan.loadDefaultConfigFile();
+		const double load = elapsedMillis(start);
+
+		start = clock();
+		system._writtenBytes = 0;
+		ConfMan.flushToDisk();
+		const double unchangedFlush = elapsedMillis(start);
+		unchangedBytes = system._writtenBytes;
+
+		ConfMan.set("talkspeed", Common::String::format("%d", i + 1), "game00000");
+
+		start = clock();
+		system._writtenBytes = 0;
+		ConfMan.flushToDisk();
+		const double changedFlush = elapsedMillis(start);
+		changedBytes = system._writtenBytes;
+
+		if (i == 0 || load < loadTime)
+			loadTime = load;
+		if (i == 0 || unchangedFlush < unchangedFlushTime)
+			unchangedFlushTime = unchangedFlush;
+		if (i == 0 || changedFlush < changedFlushTime)
+			changedFlushTime = changedFlush;
+	}
+
+	printf("%-16s %10s %10s\n", "operation", "ms", "written");
+	printf("%-16s %10.1f %10s\n", "load", loadTime, "-");
+	printf("%-16s %10.1f %10d\n", "flush unchanged", unchangedFlushTime, unchangedBytes);
+	printf("%-16s %10.1f %10d\n", "flush changed", changedFlushTime, changedBytes);
+
+	return 0;
+}
@@ -0,0 +1,16 @@
+MODULE := devtools/bench_config
+
+MODULE_OBJS := \
+	bench_config.o
+
+# The config manager is taken from the regular ScummVM libraries
+TOOL_DEPS := \
+	common/libcommon.a
+
+TOOL_LIBS := $(LIBS)
+
+# Set the name of the executable
+TOOL_EXECUTABLE := bench_config
+
+# Include common rules
+include $(srcdir)/rules.mk
@@ -0,0 +1,231 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * This is a utility which measures the rendering speed of the MT-32
+ * emulator. It plays a fixed, dense note pattern on all parts and reports
+ * the number of partial samples rendered per second for both the integer
+ * and the float renderer, together with a checksum of the output, so that
+ * changes to munt can be checked for speed and bit-exactness.
+ */
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+// HACK to allow building with the SDL backend on MinGW
+// see bug #1800764 "TOOLS: MinGW tools building broken"
+#ifdef main
+#undef main
+#endif // main
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+// Use the full C++ API of munt, it is linked statically
+#define MT32EMU_API_TYPE 0
+#include "audio/softsynth/mt32/mt32emu.h"
+
+enum {
+	kChunkLength = 256,			///< Samples rendered between two events
+	kChunksPerStep = 8,			///< Chunks between two steps of the note pattern
+	kStepsPerProgramChange = 64	///< Steps after which all parts change their timbre
+};
+
+/**
+ * A simple generator for the note pattern, so it is the same on every run.
+ */
+class PatternRandom {
+public:
+	PatternRandom() : _state(0x12345678) {}
+
+	uint32_t next(uint32_t range) {
+		_state = _state * 1103515245 + 12345;
+		return (_state >> 16) % range;
+	}
+
+private:
+	uint32_t _state;
+};
+
+struct Result {
+	double seconds;
+	uint64_t samples;
+	uint64_t partialSamples;
+	uint32_t maxPartials;
+	uint32_t checksum;
+};
+
+static void playMessage(MT32Emu::Synth &synth, uint8_t status, uint8_t data1, uint8_t data2) {
+	synth.playMsg(status | (data1 << 8) | (data2 << 16));
+}
+
+/**
+ * Advances the note pattern by one step. The melodic parts listen on MIDI
+ * channels 2 to 9 and the rhythm part on channel 10 by default.
+ */
+static void playStep(MT32Emu::Synth &synth, PatternRandom &random, uint32_t step, uint8_t *keys) {
+	for (uint8_t channel = 1; channel <= 8; ++channel) {
+		if (step % kStepsPerProgramChange == 0)
+			playMessage(synth, 0xC0 | channel, (channel * 13 + step / kStepsPerProgramChange * 7) % 128, 0);
+
+		if (random.next(4))
+			continue;
+
+		if (keys[channel])
+			playMessage(synth, 0x80 | channel, keys[channel], 0);
+		keys[channel] = 36 + random.next(48);
+		playMessage(synth, 0x90 | channel, keys[channel], 64 + random.next(64));
+	}
+
+	if (step % 2 == 0)
+		playMessage(synth, 0x99, 35 + random.next(16), 100);
+}
+
+static uint32_t updateChecksum(uint32_t checksum, const void *data, size_t length) {
+	const uint8_t *bytes = (const uint8_t *)data;
+	for (size_t i = 0; i < length; ++i)
+		checksum = (checksum ^ bytes[i]) * 16777619;
+	return checksum;
+}
+
+template<typename SampleType>
+static bool run(MT32Emu::RendererType rendererType, const MT32Emu::ROMImage &controlROM, const MT32Emu::ROMImage &pcmROM, uint32_t seconds, Result &result) {
+	MT32Emu::Synth synth;
+	synth.selectRendererType(rendererType);
+	if (!synth.open(controlROM, pcmROM))
+		return false;
+
+	const uint32_t length = synth.getStereoOutputSampleRate() * seconds;
+	std::vector<SampleType> buffer(kChunkLength * 2);
+	std::vector<MT32Emu::Bit8u> partialStates(synth.getPartialCount());
+	PatternRandom random;
+	uint8_t keys[16] = { 0 };
+
+	result.seconds = 0;
+	result.samples = 0;
+	result.partialSamples = 0;
+	result.maxPartials = 0;
+	result.checksum = 2166136261U;
+
+	for (uint32_t rendered = 0, chunk = 0; rendered < length; rendered += kChunkLength, ++chunk) {
+		if (chunk % kChunksPerStep == 0)
+			playStep(synth, random, chunk / kChunksPerStep, keys);
+
+		// Only the rendering itself is timed
+		const clock_t start = clock();
+		synth.render(&buffer[0], kChunkLength);
+		result.seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		synth.getPartialStates(&partialStates[0]);
+		uint32_t activePartials = 0;
+		for (size_t i = 0; i < partialStates.size(); ++i) {
+			if (partialStates[i] != MT32Emu::PartialState_INACTIVE)
+				++activePartials;
+		}
+		result.samples += kChunkLength;
+		result.partialSamples += (uint64_t)activePartials * kChunkLength;
+		if (activePartials > result.maxPartials)
+			result.maxPartials = activePartials;
+
+		result.checksum = updateChecksum(result.checksum, &buffer[0], buffer.size() * sizeof(SampleType));
+	}
+
+	synth.close();
+	return true;
+}
+
+static const MT32Emu::ROMImage *loadROM(const char *filename, MT32Emu::FileStream &file) {
+	if (!file.open(filename)) {
+		fprintf(stderr, "Could not open \"%s\"\n", filename);
+		return 0;
+	}
+
+	const MT32Emu::ROMImage *image = MT32Emu::ROMImage::makeROMImage(&file);
+	if (!image->getROMInfo()) {
+		fprintf(stderr, "\"%s\" is not a known MT-32 ROM\n", filename);
+		MT32Emu::ROMImage::freeROMImage(image);
+		return 0;
+	}
+
+	return image;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 3 && argc != 4) {
+		printf("Usage: %s <control ROM> <PCM ROM> [seconds]\n", argv[0]);
+		printf("Measures the rendering speed of the MT-32 emulator.\n");
+		return -1;
+	}
+
+	const uint32_t seconds = argc == 4 ? atoi(argv[3]) : 60;
+	if (!seconds) {
+		fprintf(stderr, "Invalid length \"%s\"\n", argv[3]);
+		return -1;
+	}
+
+	MT32Emu::FileStream controlFile, pcmFile;
+	const MT32Emu::ROMImage *controlROM = loadROM(argv[1], controlFile);
+	const MT32Emu::ROMImage *pcmROM = loadROM(argv[2], pcmFile);
+	if (!controlROM || !pcmROM) {
+		if (controlROM)
+			MT32Emu::ROMImage::freeROMImage(controlROM);
+		if (pcmROM)
+			MT32Emu::ROMImage::freeROMImage(pcmROM);
+		return -1;
+	}
+
+	printf("%d seconds of a dense note pattern on all parts\n\n", seconds);
+	printf("%-9s %17s %10s %10s %10s %10s\n", "renderer", "partial samples/s", "realtime", "avg. part.", "max. part.", "checksum");
+
+	static const struct {
+		const char *name;
+		MT32Emu::RendererType type;
+	} renderers[] = {
+		{ "integer", MT32Emu::RendererType_BIT16S },
+		{ "float", MT32Emu::RendererType_FLOAT }
+	};
+
+	for (size_t i = 0; i < sizeof(renderers) / sizeof(renderers[0]); ++i) {
+		Result result;
+		bool opened;
+		if (renderers[i].type == MT32Emu::RendererType_FLOAT)
+			opened = run<float>(renderers[i].type, *controlROM, *pcmROM, seconds, result);
+		else
+			opened = run<MT32Emu::Bit16s>(renderers[i].type, *controlROM, *pcmROM, seconds, result);
+
+		if (!opened) {
+			fprintf(stderr, "Could not open the synth with the given ROMs\n");
+			break;
+		}
+
+		printf("%-9s %17.0f %9.1fx %10.1f %10d   %08x\n", renderers[i].name,
+		       result.seconds > 0 ? result.partialSamples / result.seconds : 0,
+		       result.seconds > 0 ? seconds / result.seconds : 0,
+		       (double)result.partialSamples / result.samples, result.maxPartials, result.checksum);
+	}
+
+	MT32Emu::ROMImage::freeROMImage(controlROM);
+	MT32Emu::ROMImage::freeROMImage(pcmROM);
+	return 0;
+}
@@ -0,0 +1,16 @@
+MODULE := devtools/bench_mt32
+
+MODULE_OBJS := \
+	bench_mt32.o
+
+# The emulator is taken from the regular ScummVM libraries
+TOOL_DEPS := \
+	audio/softsynth/mt32/libmt32.a
+
+TOOL_LIBS := $(LIBS)
+
+# Set the name of the executable
+TOOL_EXECUTABLE := bench_mt32
+
+# Include common rules
+include $(srcdir)/rules.mk
@@ -0,0 +1,186 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * This is a utility which measures the decoding speed of the video codecs.
+ * It decodes all frames of the given QuickTime or AVI files and reports the
+ * time spent per frame, so that codec changes can be compared on the same
+ * set of sample files.
+ */
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+// HACK to allow building with the SDL backend on MinGW
+// see bug #1800764 "TOOLS: MinGW tools building broken"
+#ifdef main
+#undef main
+#endif // main
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/scummsys.h"
+#include "common/memstream.h"
+#include "common/str.h"
+#include "common/system.h"
+
+#include "graphics/surface.h"
+
+#include "video/avi_decoder.h"
+#include "video/qt_decoder.h"
+
+/**
+ * A minimal backend. The decoders only need it for the screen format,
+ * which selects their default output format, and for logging.
+ */
+class NullSystem : public OSystem {
+public:
+	const GraphicsMode *getSupportedGraphicsModes() const { return s_noGraphicsModes; }
+	int getDefaultGraphicsMode() const { return 0; }
+	bool setGraphicsMode(int mode) { return false; }
+	int getGraphicsMode() const { return 0; }
+#ifdef USE_RGB_COLOR
+	Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+#endif
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format) {}
+	int16 getHeight() { return 0; }
+	int16 getWidth() { return 0; }
+	PaletteManager *getPaletteManager() { return 0; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	Graphics::Surface *lockScreen() { return 0; }
+	void unlockScreen() {}
+	void fillScreen(uint32 col) {}
+	void updateScreen() {}
+	void setShakePos(int shakeOffset) {}
+	void showOverlay() {}
+	void hideOverlay() {}
+	Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	void clearOverlay() {}
+	void grabOverlay(void *buf, int pitch) {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	int16 getOverlayHeight() { return 0; }
+	int16 getOverlayWidth() { return 0; }
+	bool showMouse(bool visible) { return false; }
+	void warpMouse(int x, int y) {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) {}
+	uint32 getMillis(bool skipRecord) { return (uint32)((uint64)clock() * 1000 / CLOCKS_PER_SEC); }
+	void delayMillis(uint msecs) {}
+	void getTimeAndDate(TimeDate &t) const { memset(&t, 0, sizeof(t)); }
+	MutexRef createMutex() { return 0; }
+	void lockMutex(MutexRef mutex) {}
+	void unlockMutex(MutexRef mutex) {}
+	void deleteMutex(MutexRef mutex) {}
+	Audio::Mixer *getMixer() { return 0; }
+	void quit() { exit(0); }
+	void displayMessageOnOSD(const char *msg) {}
+	void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
+	void logMessage(LogMessageType::Type type, const char *message) { fputs(message, stderr); }
+
+private:
+	static const GraphicsMode s_noGraphicsModes[];
+};
+
+const OSystem::GraphicsMode NullSystem::s_noGraphicsModes[] = { { 0, 0, 0 } };
+
+static Common::SeekableReadStream *loadFile(const char *filename) {
+	FILE *file = fopen(filename, "rb");
+	if (!file) {
+		fprintf(stderr, "Could not open \"%s\"\n", filename);
+		return 0;
+	}
+
+	fseek(file, 0, SEEK_END);
+	const long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	byte *data = (byte *)malloc(size);
+	if (!data || fread(data, 1, size, file) != (size_t)size) {
+		fprintf(stderr, "Could not read \"%s\"\n", filename);
+		free(data);
+		fclose(file);
+		return 0;
+	}
+
+	fclose(file);
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
+/**
+ * Decodes all frames of the given file. The file is read into memory
+ * first, so only the demuxing and decoding are measured.
+ */
+static void benchmark(const char *filename) {
+	Common::SeekableReadStream *stream = loadFile(filename);
+	if (!stream)
+		return;
+
+	Video::VideoDecoder *decoder;
+	if (Common::String(filename).hasSuffixIgnoreCase(".avi"))
+		decoder = new Video::AVIDecoder();
+	else
+		decoder = new Video::QuickTimeDecoder();
+
+	if (!decoder->loadStream(stream)) {
+		fprintf(stderr, "\"%s\" is not a supported video\n", filename);
+		delete decoder;
+		return;
+	}
+
+	const int frameCount = decoder->getFrameCount();
+	int decodedFrames = 0;
+	int bytesPerPixel = 0;
+
+	const clock_t start = clock();
+	for (int i = 0; i < frameCount; i++) {
+		const Graphics::Surface *frame = decoder->decodeNextFrame();
+		if (frame) {
+			bytesPerPixel = frame->format.bytesPerPixel;
+			decodedFrames++;
+		}
+	}
+	const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("%-32s %4dx%-4d %4d %8d %12.3f %10.1f\n", filename, decoder->getWidth(), decoder->getHeight(),
+	       bytesPerPixel * 8, decodedFrames, decodedFrames ? seconds * 1000 / decodedFrames : 0,
+	       seconds > 0 ? decodedFrames / seconds : 0);
+
+	delete decoder;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 2) {
+		printf("Usage: %s <video file> [<video file> ...]\n", argv[0]);
+		printf("Measures the decoding speed of QuickTime and AVI files.\n");
+		return -1;
+	}
+
+	NullSystem system;
+	g_system = &system;
+
+	printf("%-32s %9s %4s %8s %12s %10s\n", "file", "size", "bpp", "frames", "ms/frame", "frames/s");
+
+	for (int i = 1; i < argc; i++)
+		benchmark(argv[i]);
+
+	return 0;
+}
@@ -0,0 +1,20 @@
+MODULE := devtools/bench_video
+
+MODULE_OBJS := \
+	bench_video.o
+
+# The decoders are taken from the regular ScummVM libraries
+TOOL_DEPS := \
+	video/libvideo.a \
+	image/libimage.a \
+	audio/libaudio.a \
+	graphics/libgraphics.a \
+	common/libcommon.a
+
+TOOL_LIBS := $(LIBS)
+
+# Set the name of the executable
+TOOL_EXECUTABLE := bench_video
+
+# Include common rules
+include $(srcdir)/rules.mk
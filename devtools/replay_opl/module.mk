@@ -0,0 +1,17 @@
+MODULE := devtools/replay_opl
+
+MODULE_OBJS := \
+	replay_opl.o
+
+# The OPL emulators are taken from the regular ScummVM libraries
+TOOL_DEPS := \
+	audio/libaudio.a \
+	common/libcommon.a
+
+TOOL_LIBS := $(LIBS)
+
+# Set the name of the executable
+TOOL_EXECUTABLE := replay_opl
+
+# Include common rules
+include $(srcdir)/rules.mk
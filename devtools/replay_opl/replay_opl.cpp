@@ -0,0 +1,418 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * This is a utility which replays an OPL register capture, as written by
+ * ScummVM when the "opl_capture" config option is set, through all OPL
+ * emulators. It reports the rendering speed and state size of every
+ * emulator and how much their output differs.
+ */
+
+// Disable symbol overrides so that we can use system headers.
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+// HACK to allow building with the SDL backend on MinGW
+// see bug #1800764 "TOOLS: MinGW tools building broken"
+#ifdef main
+#undef main
+#endif // main
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+#include "common/scummsys.h"
+#include "common/endian.h"
+#include "common/system.h"
+
+#include "audio/fmopl.h"
+#include "audio/softsynth/opl/dbopl.h"
+#include "audio/softsynth/opl/mame.h"
+#include "audio/softsynth/opl/nuked.h"
+
+/**
+ * A minimal backend. The emulator cores only need it for the time, which
+ * seeds the random noise generator of the MAME emulator, and for logging.
+ */
+class NullSystem : public OSystem {
+public:
+	const GraphicsMode *getSupportedGraphicsModes() const { return s_noGraphicsModes; }
+	int getDefaultGraphicsMode() const { return 0; }
+	bool setGraphicsMode(int mode) { return false; }
+	int getGraphicsMode() const { return 0; }
+#ifdef USE_RGB_COLOR
+	Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+#endif
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format) {}
+	int16 getHeight() { return 0; }
+	int16 getWidth() { return 0; }
+	PaletteManager *getPaletteManager() { return 0; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	Graphics::Surface *lockScreen() { return 0; }
+	void unlockScreen() {}
+	void fillScreen(uint32 col) {}
+	void updateScreen() {}
+	void setShakePos(int shakeOffset) {}
+	void showOverlay() {}
+	void hideOverlay() {}
+	Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	void clearOverlay() {}
+	void grabOverlay(void *buf, int pitch) {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	int16 getOverlayHeight() { return 0; }
+	int16 getOverlayWidth() { return 0; }
+	bool showMouse(bool visible) { return false; }
+	void warpMouse(int x, int y) {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) {}
+	uint32 getMillis(bool skipRecord) { return (uint32)((uint64)clock() * 1000 / CLOCKS_PER_SEC); }
+	void delayMillis(uint msecs) {}
+	void getTimeAndDate(TimeDate &t) const { memset(&t, 0, sizeof(t)); }
+	MutexRef createMutex() { return 0; }
+	void lockMutex(MutexRef mutex) {}
+	void unlockMutex(MutexRef mutex) {}
+	void deleteMutex(MutexRef mutex) {}
+	Audio::Mixer *getMixer() { return 0; }
+	void quit() { exit(0); }
+	void displayMessageOnOSD(const char *msg) {}
+	void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
+	void logMessage(LogMessageType::Type type, const char *message) { fputs(message, stderr); }
+
+private:
+	static const GraphicsMode s_noGraphicsModes[];
+};
+
+const OSystem::GraphicsMode NullSystem::s_noGraphicsModes[] = { { 0, 0, 0 } };
+
+struct CaptureEntry {
+	uint32 position;
+	byte type;
+	uint16 address;
+	byte value;
+};
+
+struct Capture {
+	OPL::Config::OplType type;
+	uint32 rate;
+	uint32 length;
+	std::vector<CaptureEntry> entries;
+};
+
+/**
+ * The emulator cores are driven directly, since the OPL classes wrapping
+ * them need a running backend for their mixer stream and timers.
+ */
+class Core {
+public:
+	virtual ~Core() {}
+
+	virtual const char *getName() const = 0;
+	virtual bool supports(OPL::Config::OplType type) const = 0;
+	virtual void reset(OPL::Config::OplType type, uint32 rate) = 0;
+	virtual void writeReg(int r, int v) = 0;
+
+	/**
+	 * Renders the given number of samples, downmixed to mono.
+	 */
+	virtual void generate(int16 *buffer, uint32 length) = 0;
+
+	/**
+	 * Returns the size of the emulator state in bytes.
+	 */
+	virtual uint32 getStateSize() const = 0;
+};
+
+class MameCore : public Core {
+public:
+	MameCore() : _opl(0) {}
+	~MameCore() { if (_opl) OPL::MAME::OPLDestroy(_opl); }
+
+	const char *getName() const { return "mame"; }
+	bool supports(OPL::Config::OplType type) const { return type == OPL::Config::kOpl2; }
+
+	void reset(OPL::Config::OplType type, uint32 rate) {
+		if (_opl)
+			OPL::MAME::OPLDestroy(_opl);
+		_opl = OPL::MAME::makeAdLibOPL(rate);
+	}
+
+	void writeReg(int r, int v) { OPL::MAME::OPLWriteReg(_opl, r, v); }
+	void generate(int16 *buffer, uint32 length) { OPL::MAME::YM3812UpdateOne(_opl, buffer, length); }
+	uint32 getStateSize() const { return sizeof(OPL::MAME::FM_OPL); }
+
+private:
+	OPL::MAME::FM_OPL *_opl;
+};
+
+#ifndef DISABLE_DOSBOX_OPL
+class DOSBoxCore : public Core {
+public:
+	DOSBoxCore() : _chip(0) {}
+	~DOSBoxCore() { delete _chip; }
+
+	const char *getName() const { return "db"; }
+	bool supports(OPL::Config::OplType type) const { return true; }
+
+	void reset(OPL::Config::OplType type, uint32 rate) {
+		delete _chip;
+		_chip = new OPL::DOSBox::DBOPL::Chip();
+		OPL::DOSBox::DBOPL::InitTables();
+		_chip->Setup(rate);
+
+		if (type == OPL::Config::kDualOpl2)
+			_chip->WriteReg(0x105, 1);
+	}
+
+	void writeReg(int r, int v) {
+		// The timer registers are handled outside of the core
+		if (r >= 0x02 && r <= 0x04)
+			return;
+		_chip->WriteReg(r, v);
+	}
+
+	void generate(int16 *buffer, uint32 length) {
+		const uint32 blockLength = 512;
+		int32 block[blockLength * 2];
+
+		while (length > 0) {
+			const uint32 step = MIN<uint32>(length, blockLength);
+
+			if (_chip->opl3Active) {
+				_chip->GenerateBlock3(step, block);
+				for (uint32 i = 0; i < step; ++i)
+					*buffer++ = CLIP<int32>((block[i * 2] + block[i * 2 + 1]) / 2, -32768, 32767);
+			} else {
+				_chip->GenerateBlock2(step, block);
+				for (uint32 i = 0; i < step; ++i)
+					*buffer++ = CLIP<int32>(block[i], -32768, 32767);
+			}
+
+			length -= step;
+		}
+	}
+
+	uint32 getStateSize() const { return sizeof(OPL::DOSBox::DBOPL::Chip); }
+
+private:
+	OPL::DOSBox::DBOPL::Chip *_chip;
+};
+#endif
+
+#ifndef DISABLE_NUKED_OPL
+class NukedCore : public Core {
+public:
+	const char *getName() const { return "nuked"; }
+	bool supports(OPL::Config::OplType type) const { return true; }
+
+	void reset(OPL::Config::OplType type, uint32 rate) {
+		OPL::NUKED::OPL3_Reset(&_chip, rate);
+
+		if (type == OPL::Config::kDualOpl2)
+			OPL::NUKED::OPL3_WriteReg(&_chip, 0x105, 0x01);
+	}
+
+	void writeReg(int r, int v) { OPL::NUKED::OPL3_WriteRegBuffered(&_chip, r, v); }
+
+	void generate(int16 *buffer, uint32 length) {
+		const uint32 blockLength = 512;
+		int16 block[blockLength * 2];
+
+		while (length > 0) {
+			const uint32 step = MIN<uint32>(length, blockLength);
+
+			OPL::NUKED::OPL3_GenerateStream(&_chip, block, step);
+			for (uint32 i = 0; i < step; ++i)
+				*buffer++ = (block[i * 2] + block[i * 2 + 1]) / 2;
+
+			length -= step;
+		}
+	}
+
+	uint32 getStateSize() const { return sizeof(OPL::NUKED::opl3_chip); }
+
+private:
+	OPL::NUKED::opl3_chip _chip;
+};
+#endif
+
+static bool loadCapture(const char *filename, Capture &capture) {
+	FILE *file = fopen(filename, "rb");
+	if (!file) {
+		fprintf(stderr, "Could not open \"%s\"\n", filename);
+		return false;
+	}
+
+	byte header[10];
+	if (fread(header, sizeof(header), 1, file) != 1 || READ_BE_UINT32(header) != MKTAG('O', 'P', 'L', 'C')) {
+		fprintf(stderr, "\"%s\" is not an OPL capture\n", filename);
+		fclose(file);
+		return false;
+	}
+
+	if (header[4] != OPL::kCaptureVersion) {
+		fprintf(stderr, "Unsupported capture version %d\n", header[4]);
+		fclose(file);
+		return false;
+	}
+
+	capture.type = (OPL::Config::OplType)header[5];
+	capture.rate = READ_LE_UINT32(header + 6);
+	capture.length = 0;
+
+	byte data[8];
+	while (fread(data, sizeof(data), 1, file) == 1) {
+		CaptureEntry entry;
+		entry.position = READ_LE_UINT32(data);
+		entry.type = data[4];
+		entry.address = READ_LE_UINT16(data + 5);
+		entry.value = data[7];
+
+		capture.length = entry.position;
+		if (entry.type == OPL::kCaptureEnd)
+			break;
+
+		capture.entries.push_back(entry);
+	}
+
+	fclose(file);
+	return true;
+}
+
+/**
+ * Renders the capture with the given core. Port writes are turned into
+ * register writes, using the address latched for each register bank.
+ */
+static double replay(Core &core, const Capture &capture, std::vector<int16> &output) {
+	output.resize(capture.length);
+
+	const clock_t start = clock();
+
+	core.reset(capture.type, capture.rate);
+
+	uint32 position = 0;
+	int latch[2] = { 0, 0 };
+
+	for (size_t i = 0; i < capture.entries.size(); ++i) {
+		const CaptureEntry &entry = capture.entries[i];
+
+		if (entry.position > position) {
+			core.generate(&output[position], entry.position - position);
+			position = entry.position;
+		}
+
+		if (entry.type == OPL::kCaptureRegisterWrite) {
+			core.writeReg(entry.address, entry.value);
+		} else if (entry.type == OPL::kCapturePortWrite) {
+			const int bank = (entry.address >> 1) & 1;
+			const bool bothBanks = capture.type == OPL::Config::kDualOpl2 && (entry.address & 8);
+
+			if (!(entry.address & 1)) {
+				latch[bank] = entry.value;
+				if (bothBanks)
+					latch[bank ^ 1] = entry.value;
+			} else if (capture.type == OPL::Config::kOpl2) {
+				core.writeReg(latch[0], entry.value);
+			} else if (bothBanks) {
+				core.writeReg(latch[0], entry.value);
+				core.writeReg(latch[1] | 0x100, entry.value);
+			} else {
+				core.writeReg(latch[bank] | (bank << 8), entry.value);
+			}
+		}
+	}
+
+	if (capture.length > position)
+		core.generate(&output[position], capture.length - position);
+
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 2) {
+		printf("Usage: %s <capture file>\n", argv[0]);
+		printf("Replays an OPL register capture through all OPL emulators.\n");
+		return -1;
+	}
+
+	NullSystem system;
+	g_system = &system;
+
+	Capture capture;
+	if (!loadCapture(argv[1], capture))
+		return -1;
+
+	printf("%d register writes, %.2f seconds at %d Hz, OPL type %d\n\n",
+	       (int)capture.entries.size(), (double)capture.length / capture.rate, capture.rate, capture.type);
+
+	std::vector<Core *> cores;
+	cores.push_back(new MameCore());
+#ifndef DISABLE_DOSBOX_OPL
+	cores.push_back(new DOSBoxCore());
+#endif
+#ifndef DISABLE_NUKED_OPL
+	cores.push_back(new NukedCore());
+#endif
+
+	std::vector<int16> reference;
+	const char *referenceName = 0;
+
+	printf("%-8s %14s %10s %12s %12s %10s\n", "emulator", "samples/s", "realtime", "state bytes", "rms diff", "max diff");
+
+	for (size_t i = 0; i < cores.size(); ++i) {
+		Core &core = *cores[i];
+		if (!core.supports(capture.type)) {
+			printf("%-8s does not support OPL type %d\n", core.getName(), capture.type);
+			continue;
+		}
+
+		std::vector<int16> output;
+		const double seconds = replay(core, capture, output);
+		const double samplesPerSecond = seconds > 0 ? capture.length / seconds : 0;
+
+		// Compare the output against the first emulator which was run
+		double rmsDiff = 0;
+		int maxDiff = 0;
+		if (!referenceName) {
+			reference = output;
+			referenceName = core.getName();
+		} else {
+			for (uint32 j = 0; j < capture.length; ++j) {
+				const int diff = ABS(output[j] - reference[j]);
+				rmsDiff += (double)diff * diff;
+				maxDiff = MAX(maxDiff, diff);
+			}
+			rmsDiff = capture.length ? sqrt(rmsDiff / capture.length) : 0;
+		}
+
+		printf("%-8s %14.0f %9.1fx %12d %12.1f %10d\n", core.getName(), samplesPerSecond,
+		       samplesPerSecond / capture.rate, core.getStateSize(), rmsDiff, maxDiff);
+	}
+
+	if (referenceName)
+		printf("\nDifferences are relative to the \"%s\" emulator\n", referenceName);
+
+	for (size_t i = 0; i < cores.size(); ++i)
+		delete cores[i];
+
+	return 0;
+}
@@ -55,6 +55,7 @@ Console::Console(AgiEngine *vm) : GUI::Debugger() {
 	registerCmd("vmvars",          WRAP_METHOD(Console, Cmd_VmVars));
 	registerCmd("vmflags",         WRAP_METHOD(Console, Cmd_VmFlags));
 	registerCmd("disableautosave", WRAP_METHOD(Console, Cmd_DisableAutomaticSave));
+	registerCmd("benchmark_pics",  WRAP_METHOD(Console, Cmd_BenchmarkPictures));
 }
 
 bool Console::Cmd_SetVar(int argc, const char **argv) {
@@ -626,6 +627,50 @@ bool Console::Cmd_DisableAutomaticSave(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_BenchmarkPictures(int argc, const char **argv) {
+	// Keep the current screens, every picture is drawn over them
+	byte *savedScreens = new byte[SCRIPT_WIDTH * SCRIPT_HEIGHT * 2];
+	_vm->_gfx->block_save(0, 0, SCRIPT_WIDTH, SCRIPT_HEIGHT, savedScreens);
+	int16 savedResourceNr = _vm->_picture->getResourceNr();
+
+	uint32 totalTime = 0;
+	uint32 slowestTime = 0;
+	int slowestNr = -1;
+	int pictureCount = 0;
+
+	for (int resourceNr = 0; resourceNr < MAX_DIRECTORY_ENTRIES; resourceNr++) {
+		if (_vm->_game.dirPic[resourceNr].offset == _EMPTY)
+			continue;
+
+		bool wasLoaded = _vm->_game.dirPic[resourceNr].flags & RES_LOADED;
+		if (!wasLoaded && _vm->agiLoadResource(RESOURCETYPE_PICTURE, resourceNr) != errOK)
+			continue;
+
+		uint32 startTime = g_system->getMillis();
+		_vm->_picture->drawPictureResource(resourceNr, true, false, SCRIPT_WIDTH, SCRIPT_HEIGHT, false);
+		uint32 pictureTime = g_system->getMillis() - startTime;
+
+		totalTime += pictureTime;
+		pictureCount++;
+		if (pictureTime >= slowestTime) {
+			slowestTime = pictureTime;
+			slowestNr = resourceNr;
+		}
+
+		if (!wasLoaded)
+			_vm->agiUnloadResource(RESOURCETYPE_PICTURE, resourceNr);
+	}
+
+	_vm->_gfx->block_restore(0, 0, SCRIPT_WIDTH, SCRIPT_HEIGHT, savedScreens);
+	_vm->_picture->setResourceNr(savedResourceNr);
+	delete[] savedScreens;
+
+	debugPrintf("Drew %d pictures in %d ms\n", pictureCount, totalTime);
+	if (slowestNr >= 0)
+		debugPrintf("Slowest picture: %d (%d ms)\n", slowestNr, slowestTime);
+	return true;
+}
+
 bool Console::parseInteger(const char *argument, int &result) {
 	char *endPtr = 0;
 	int idxLen = strlen(argument);
@@ -470,18 +470,6 @@ void GfxMgr::putFontPixelOnDisplay(int16 baseX, int16 baseY, int16 addX, int16 a
 	}
 }
 
-byte GfxMgr::getColor(int16 x, int16 y) {
-	int offset = y * SCRIPT_WIDTH + x;
-
-	return _gameScreen[offset];
-}
-
-byte GfxMgr::getPriority(int16 x, int16 y) {
-	int offset = y * SCRIPT_WIDTH + x;
-
-	return _priorityScreen[offset];
-}
-
 // used, when a control pixel is found
 // will search downwards and compare priority in case any is found
 bool GfxMgr::checkControlPixel(int16 x, int16 y, byte viewPriority) {
@@ -168,8 +168,8 @@ public:
 	void putPixelOnDisplay(int16 x, int16 adjX, int16 y, int16 adjY, byte color);
 	void putFontPixelOnDisplay(int16 baseX, int16 baseY, int16 addX, int16 addY, byte color, bool isHires);
 
-	byte getColor(int16 x, int16 y);
-	byte getPriority(int16 x, int16 y);
+	byte getColor(int16 x, int16 y) { return _gameScreen[y * SCRIPT_WIDTH + x]; }
+	byte getPriority(int16 x, int16 y) { return _priorityScreen[y * SCRIPT_WIDTH + x]; }
 	bool checkControlPixel(int16 x, int16 y, byte newPriority);
 
 	byte getCGAMixtureColor(byte color);
@@ -46,6 +46,12 @@ PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_currentStep = 0;
 
 	_width = _height = 0;
+
+	_pictureCacheCounter = 0;
+}
+
+PictureMgr::~PictureMgr() {
+	clearPictureCache();
 }
 
 void PictureMgr::putVirtPixel(int x, int y) {
@@ -839,41 +845,38 @@ void PictureMgr::draw_Fill(int16 x, int16 y) {
 		return;
 
 	// Push initial pixel on the stack
-	Common::Stack<Common::Point> stack;
-	stack.push(Common::Point(x, y));
+	_fillStack.clear();
+	_fillStack.push(Common::Point(x, y));
 
 	// Exit if stack is empty
-	while (!stack.empty()) {
-		Common::Point p = stack.pop();
-		unsigned int c;
-		bool newspanUp, newspanDown;
+	while (!_fillStack.empty()) {
+		Common::Point p = _fillStack.pop();
 
 		if (!draw_FillCheck(p.x, p.y))
 			continue;
 
-		// Scan for left border
-		for (c = p.x - 1; draw_FillCheck(c, p.y); c--)
-			;
+		// Find both borders of the span and fill it in one go
+		int16 left = p.x, right = p.x;
+		while (draw_FillCheck(left - 1, p.y))
+			left--;
+		while (draw_FillCheck(right + 1, p.y))
+			right++;
 
-		newspanUp = newspanDown = true;
-		for (c++; draw_FillCheck(c, p.y); c++) {
+		for (int16 c = left; c <= right; c++)
 			putVirtPixel(c, p.y);
-			if (draw_FillCheck(c, p.y - 1)) {
-				if (newspanUp) {
-					stack.push(Common::Point(c, p.y - 1));
-					newspanUp = false;
-				}
-			} else {
-				newspanUp = true;
-			}
 
-			if (draw_FillCheck(c, p.y + 1)) {
-				if (newspanDown) {
-					stack.push(Common::Point(c, p.y + 1));
-					newspanDown = false;
+		// Push one seed for every fillable run directly above and below
+		for (int16 nextY = p.y - 1; nextY <= p.y + 1; nextY += 2) {
+			bool newSpan = true;
+			for (int16 c = left; c <= right; c++) {
+				if (draw_FillCheck(c, nextY)) {
+					if (newSpan) {
+						_fillStack.push(Common::Point(c, nextY));
+						newSpan = false;
+					}
+				} else {
+					newSpan = true;
 				}
-			} else {
-				newspanDown = true;
 			}
 		}
 	}
@@ -916,6 +919,35 @@ int PictureMgr::draw_FillCheck(int16 x, int16 y) {
 int PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256, int16 pic_width, int16 pic_height) {
 	debugC(8, kDebugLevelResources, "(%d)", resourceNr);
 
+	drawPictureResource(resourceNr, clearScreen, agi256, pic_width, pic_height);
+
+	if (clearScreen)
+		_vm->clearImageStack();
+	_vm->recordImageStackCall(ADD_PIC, resourceNr, clearScreen, agi256, 0, 0, 0, 0);
+
+	return errOK;
+}
+
+void PictureMgr::drawPictureResource(int16 resourceNr, bool clearScreen, bool agi256, int16 pic_width, int16 pic_height, bool useCache) {
+	// Only pictures drawn onto a cleared full screen can be cached, as
+	// anything else depends on what was on the screen before
+	bool cacheable = clearScreen && !agi256 && pic_width == SCRIPT_WIDTH && pic_height == SCRIPT_HEIGHT
+		&& _xOffset == 0 && _yOffset == 0 && !(_flags & kPicFStep);
+
+	if (cacheable && useCache) {
+		PictureCacheEntry *entry = findCachedPicture(resourceNr);
+		if (entry) {
+			_gfx->block_restore(0, 0, SCRIPT_WIDTH, SCRIPT_HEIGHT, entry->screens);
+			entry->lastUsed = ++_pictureCacheCounter;
+			_resourceNr = resourceNr;
+			_data = _vm->_game.pictures[resourceNr].rdata;
+			_dataSize = _vm->_game.dirPic[resourceNr].len;
+			_width = pic_width;
+			_height = pic_height;
+			return;
+		}
+	}
+
 	_patCode = 0;
 	_patNum = 0;
 	_priOn = _scrOn = false;
@@ -941,11 +973,49 @@ int PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256, i
 		drawPictureAGI256();
 	}
 
-	if (clearScreen)
-		_vm->clearImageStack();
-	_vm->recordImageStackCall(ADD_PIC, resourceNr, clearScreen, agi256, 0, 0, 0, 0);
+	if (cacheable && useCache)
+		cachePicture(resourceNr);
+}
 
-	return errOK;
+PictureCacheEntry *PictureMgr::findCachedPicture(int16 resourceNr) {
+	for (uint i = 0; i < _pictureCache.size(); i++) {
+		PictureCacheEntry &entry = _pictureCache[i];
+		if (entry.resourceNr == resourceNr && entry.dataSize == _vm->_game.dirPic[resourceNr].len
+				&& entry.pictureVersion == _pictureVersion && entry.flags == _flags)
+			return &entry;
+	}
+	return nullptr;
+}
+
+void PictureMgr::cachePicture(int16 resourceNr) {
+	PictureCacheEntry *entry = nullptr;
+
+	if (_pictureCache.size() < PICTURE_CACHE_SIZE) {
+		PictureCacheEntry newEntry;
+		newEntry.screens = new byte[SCRIPT_WIDTH * SCRIPT_HEIGHT * 2];
+		_pictureCache.push_back(newEntry);
+		entry = &_pictureCache.back();
+	} else {
+		// Replace the least recently used picture
+		entry = &_pictureCache[0];
+		for (uint i = 1; i < _pictureCache.size(); i++) {
+			if (_pictureCache[i].lastUsed < entry->lastUsed)
+				entry = &_pictureCache[i];
+		}
+	}
+
+	entry->resourceNr = resourceNr;
+	entry->dataSize = _vm->_game.dirPic[resourceNr].len;
+	entry->pictureVersion = _pictureVersion;
+	entry->flags = _flags;
+	entry->lastUsed = ++_pictureCacheCounter;
+	_gfx->block_save(0, 0, SCRIPT_WIDTH, SCRIPT_HEIGHT, entry->screens);
+}
+
+void PictureMgr::clearPictureCache() {
+	for (uint i = 0; i < _pictureCache.size(); i++)
+		delete[] _pictureCache[i].screens;
+	_pictureCache.clear();
 }
 
 /**
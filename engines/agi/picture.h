@@ -57,14 +57,33 @@ enum AgiPictureFlags {
 class AgiBase;
 class GfxMgr;
 
+#define PICTURE_CACHE_SIZE  8
+
+/**
+ * Visual and priority screens of a fully drawn picture, so that showing
+ * the same room again does not have to interpret the picture data again.
+ * Entries are kept when the picture resource is discarded, as scripts
+ * usually discard a picture right after drawing it.
+ */
+struct PictureCacheEntry {
+	int16 resourceNr;
+	uint32 dataSize;
+	AgiPictureVersion pictureVersion;
+	int flags;
+	byte *screens;          /**< visual screen followed by priority screen */
+	uint32 lastUsed;
+};
+
 class PictureMgr {
 	AgiBase *_vm;
 	GfxMgr *_gfx;
 
 public:
 	PictureMgr(AgiBase *agi, GfxMgr *gfx);
+	~PictureMgr();
 
 	int16 getResourceNr() { return _resourceNr; };
+	void setResourceNr(int16 resourceNr) { _resourceNr = resourceNr; }
 
 private:
 	void draw_xCorner(bool skipOtherCoords = false);
@@ -82,7 +101,22 @@ public:
 	int decodePicture(byte *data, uint32 length, int clear, int pic_width = _DEFAULT_WIDTH, int pic_height = _DEFAULT_HEIGHT);
 	int unloadPicture(int);
 	void drawPicture();
+
+	/**
+	 * Draws a loaded picture resource onto the game screens, without
+	 * recording it in the image stack. Fully drawn pictures are cached
+	 * and restored from the cache when useCache is set.
+	 */
+	void drawPictureResource(int16 resourceNr, bool clearScreen, bool agi256, int16 pic_width, int16 pic_height, bool useCache = true);
+
+	/**
+	 * Drops all cached pictures
+	 */
+	void clearPictureCache();
 private:
+	PictureCacheEntry *findCachedPicture(int16 resourceNr);
+	void cachePicture(int16 resourceNr);
+
 	void drawPictureC64();
 	void drawPictureV1();
 	void drawPictureV15();
@@ -151,6 +185,10 @@ private:
 
 	int _flags;
 	int _currentStep;
+
+	Common::Array<PictureCacheEntry> _pictureCache;
+	uint32 _pictureCacheCounter;
+	Common::Stack<Common::Point> _fillStack;
 };
 
 } // End of namespace Agi
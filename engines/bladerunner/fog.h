@@ -64,6 +64,13 @@ protected:
 	float      _parameter2;
 	float      _parameter3;
 
+	// The camera position transformed into the fog space. It is the same
+	// for every position evaluated in a frame, so it is only recalculated
+	// when the camera or the fog moves.
+	Vector3    _viewPosition;
+	Vector3    _viewPositionT;
+	bool       _viewPositionTValid;
+
 	Fog       *_next;
 
 public:
@@ -79,6 +86,7 @@ public:
 protected:
 	int readCommon(Common::ReadStream *stream);
 	void readAnimationData(Common::ReadStream *stream, int count);
+	Vector3 transformViewPosition(Vector3 viewPosition);
 
 };
 
@@ -88,6 +96,13 @@ class FogCone : public Fog {
 };
 
 class FogSphere : public Fog {
+	double _parameter1Cos;
+	float  _parameter1Tan;
+
+public:
+	FogSphere() : _parameter1Cos(0.0), _parameter1Tan(0.0f) {}
+
+private:
 	void read(Common::ReadStream *stream, int frameCount);
 	void calculateCoeficient(Vector3 position, Vector3 viewPosition, float *coeficient);
 };
@@ -119,6 +119,7 @@ void Lights::setupFrame(int frame) {
 	if (frame == _frame) {
 		return;
 	}
+	_frame = frame;
 
 	for (uint i = 0; i < _lights.size(); i++) {
 		_lights[i]->setupFrame(frame);
@@ -61,6 +61,12 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	for (int i = 0; i < 256; i++) {
+		_shadedColors[i]       = 0;
+		_shadedColorsSerial[i] = 0;
+	}
+	_shadedColorsCurrentSerial = 0;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -545,6 +551,19 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// The lighting is constant for the whole line, so colors without a
+	// screen effect only need to be shaded once per palette entry
+	bool hasScreenEffects = false;
+	if (advanced) {
+		hasScreenEffects = !_screenEffects->_entries.empty();
+		if (++_shadedColorsCurrentSerial == 0) {
+			for (int i = 0; i < 256; i++) {
+				_shadedColorsSerial[i] = 0;
+			}
+			_shadedColorsCurrentSerial = 1;
+		}
+	}
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -575,15 +594,19 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 					int color555 = palette.color555[p[2]];
 					if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
-						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
+						if (hasScreenEffects) {
+							_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
+						}
 
-						int bladeToScummVmConstant = 256 / 32;
-						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+						if (aescColor.r == 0 && aescColor.g == 0 && aescColor.b == 0) {
+							if (_shadedColorsSerial[p[2]] != _shadedColorsCurrentSerial) {
+								_shadedColors[p[2]] = shadeColor(palette.color[p[2]], aescColor);
+								_shadedColorsSerial[p[2]] = _shadedColorsCurrentSerial;
+							}
+							color555 = _shadedColors[p[2]];
+						} else {
+							color555 = shadeColor(palette.color[p[2]], aescColor);
+						}
 					}
 					for (int x = previousVertexX; x != vertexX; ++x) {
 						if (vertexZ < zbufLinePtr[x]) {
@@ -599,6 +622,16 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 	}
 }
 
+uint16 SliceRenderer::shadeColor(const Color256 &paletteColor, const Color256 &aescColor) const {
+	Color256 color = paletteColor;
+	color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
+	color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
+	color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
+
+	int bladeToScummVmConstant = 256 / 32;
+	return _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+}
+
 void SliceRenderer::drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer) {
 	Matrix4x3 mOffset(
 		1.0f, 0.0f, 0.0f, _framePos.x,
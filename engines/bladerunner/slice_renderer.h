@@ -89,6 +89,13 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Lit colors of the palette entries used by the current slice line,
+	// valid where _shadedColorsSerial matches _shadedColorsCurrentSerial.
+	// Only used for pixels without screen effects.
+	uint16 _shadedColors[256];
+	uint32 _shadedColorsSerial[256];
+	uint32 _shadedColorsCurrentSerial;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -115,6 +122,7 @@ private:
 	void loadFrame(int animation, int frame);
 
 	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y);
+	uint16 shadeColor(const Color256 &paletteColor, const Color256 &aescColor) const;
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 };
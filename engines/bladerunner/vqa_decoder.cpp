@@ -148,6 +148,14 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+
+	for (int i = 0; i < kFrameCacheSize; ++i) {
+		_frameCache[i].frame    = -1;
+		_frameCache[i].size     = 0;
+		_frameCache[i].capacity = 0;
+		_frameCache[i].data     = nullptr;
+	}
+	_frameCacheNext = 0;
 }
 
 VQADecoder::~VQADecoder() {
@@ -157,11 +165,16 @@ VQADecoder::~VQADecoder() {
 	delete _audioTrack;
 	delete _videoTrack;
 	delete[] _frameInfo;
+
+	for (int i = 0; i < kFrameCacheSize; ++i) {
+		delete[] _frameCache[i].data;
+	}
 }
 
 bool VQADecoder::loadStream(Common::SeekableReadStream *s) {
 	// close();
 	_s = s;
+	clearFrameCache();
 
 	IFFChunkHeader chd;
 	uint32 type;
@@ -242,16 +255,16 @@ void VQADecoder::decodeLights(Lights *lights) {
 	_videoTrack->decodeLights(lights);
 }
 
-void VQADecoder::readPacket(uint readFlags) {
+void VQADecoder::readPacket(Common::SeekableReadStream *s, uint readFlags) {
 	IFFChunkHeader chd;
 
-	if (remain(_s) < 8) {
-		warning("VQADecoder::readPacket: remain: %d", remain(_s));
-		assert(remain(_s) < 8);
+	if (remain(s) < 8) {
+		warning("VQADecoder::readPacket: remain: %d", remain(s));
+		assert(remain(s) < 8);
 	}
 
 	do {
-		if (!readIFFChunkHeader(_s, &chd)) {
+		if (!readIFFChunkHeader(s, &chd)) {
 			error("VQADecoder::readPacket: Error reading chunk header");
 			return;
 		}
@@ -259,18 +272,18 @@ void VQADecoder::readPacket(uint readFlags) {
 		bool rc = false;
 		// Video track
 		switch (chd.id) {
-		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readAESC(_s, chd.size); break;
-		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readLITE(_s, chd.size); break;
-		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVIEW(_s, chd.size); break;
-		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFL(_s, chd.size, readFlags); break;
-		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFR(_s, chd.size, readFlags); break;
-		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readZBUF(_s, chd.size); break;
+		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readAESC(s, chd.size); break;
+		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readLITE(s, chd.size); break;
+		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVIEW(s, chd.size); break;
+		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFL(s, chd.size, readFlags); break;
+		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFR(s, chd.size, readFlags); break;
+		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readZBUF(s, chd.size); break;
 		// Sound track
-		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSN2J(_s, chd.size); break;
-		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSND2(_s, chd.size); break;
+		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSN2J(s, chd.size); break;
+		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSND2(s, chd.size); break;
 		default:
 			rc = false;
-			_s->skip(roundup(chd.size));
+			s->skip(roundup(chd.size));
 		}
 
 		if (!rc) {
@@ -285,11 +298,59 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 		error("VQADecoder::readFrame: frame %d out of bounds, frame count is %d", frame, numFrames());
 	}
 
+	_readingFrame = frame;
+
+	const CachedFrame *cachedFrame = cacheFrame(frame);
+	if (cachedFrame) {
+		Common::MemoryReadStream s(cachedFrame->data, cachedFrame->size);
+		readPacket(&s, readFlags);
+	} else {
+		uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+		_s->seek(frameOffset);
+		readPacket(_s, readFlags);
+	}
+}
+
+const VQADecoder::CachedFrame *VQADecoder::cacheFrame(int frame) {
+	for (int i = 0; i < kFrameCacheSize; ++i) {
+		if (_frameCache[i].frame == frame) {
+			return &_frameCache[i];
+		}
+	}
+
+	// Frames are stored one after another, so a frame ends where the next one starts
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
+	uint32 frameEnd = (frame + 1 < numFrames()) ? 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF) : _s->size();
+	if (frameEnd <= frameOffset || frameEnd > (uint32)_s->size()) {
+		return nullptr;
+	}
+
+	CachedFrame &cachedFrame = _frameCache[_frameCacheNext];
+	_frameCacheNext = (_frameCacheNext + 1) % kFrameCacheSize;
+
+	uint32 size = frameEnd - frameOffset;
+	if (cachedFrame.capacity < size) {
+		delete[] cachedFrame.data;
+		cachedFrame.data = new uint8[size];
+		cachedFrame.capacity = size;
+	}
+
 	_s->seek(frameOffset);
+	if (_s->read(cachedFrame.data, size) != size) {
+		cachedFrame.frame = -1;
+		return nullptr;
+	}
 
-	_readingFrame = frame;
-	readPacket(readFlags);
+	cachedFrame.frame = frame;
+	cachedFrame.size = size;
+	return &cachedFrame;
+}
+
+void VQADecoder::clearFrameCache() {
+	for (int i = 0; i < kFrameCacheSize; ++i) {
+		_frameCache[i].frame = -1;
+	}
+	_frameCacheNext = 0;
 }
 
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
@@ -137,6 +137,17 @@ private:
 		uint8  *data;
 	};
 
+	struct CachedFrame {
+		int     frame;
+		uint32  size;
+		uint32  capacity;
+		uint8  *data;
+	};
+
+	enum {
+		kFrameCacheSize = 16
+	};
+
 	class VQAVideoTrack;
 	class VQAAudioTrack;
 
@@ -152,6 +163,12 @@ private:
 
 	uint32  *_frameInfo;
 
+	// Raw data of recently read frames. Audio is read ahead of the video
+	// and loops play the same frames over and over, so this way most
+	// frames are read from the disk only once, in a single read.
+	CachedFrame _frameCache[kFrameCacheSize];
+	int         _frameCacheNext;
+
 	uint32   _maxVIEWChunkSize;
 	uint32   _maxZBUFChunkSize;
 	uint32   _maxAESCChunkSize;
@@ -159,7 +176,10 @@ private:
 	VQAVideoTrack *_videoTrack;
 	VQAAudioTrack *_audioTrack;
 
-	void readPacket(uint readFlags);
+	void readPacket(Common::SeekableReadStream *s, uint readFlags);
+
+	const CachedFrame *cacheFrame(int frame);
+	void clearFrameCache();
 
 	bool readVQHD(Common::SeekableReadStream *s, uint32 size);
 	bool readMSCI(Common::SeekableReadStream *s, uint32 size);
@@ -110,8 +110,11 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, Graphics::Surface *cust
 		result = -1;
 	} else if (advanceFrame) {
 		_frame = _frameNext;
+		uint32 readStartTime = _vm->_system->getMillis();
 		_decoder.readFrame(_frameNext, kVQAReadVideo);
+		uint32 decodeStartTime = _vm->_system->getMillis();
 		_decoder.decodeVideoFrame(customSurface != nullptr ? customSurface : _surface, _frameNext);
+		debug(9, "VQAPlayer::update: frame %d read in %d ms, decoded in %d ms", _frame, decodeStartTime - readStartTime, _vm->_system->getMillis() - decodeStartTime);
 
 		int audioPreloadFrames = 14;
 
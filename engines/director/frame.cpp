@@ -415,7 +415,8 @@ void Frame::prepareFrame(Score *score) {
 		playSoundChannel();
 	}
 
-	g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	// Transitions draw to the screen directly, so refresh all of it afterwards
+	score->copyStageToScreen(_transType != 0);
 }
 
 void Frame::playSoundChannel() {
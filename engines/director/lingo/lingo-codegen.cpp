@@ -54,12 +54,14 @@ namespace Director {
 
 void Lingo::execute(uint pc) {
 	for(_pc = pc; (*_currentScript)[_pc] != STOP && !_returning;) {
-		Common::String instr = decodeInstruction(_pc);
+		// Decoding the instruction text is expensive, only do it when tracing
+		if (debugChannelSet(1, kDebugLingoExec)) {
+			if (debugChannelSet(5, kDebugLingoExec))
+				printStack("Stack before: ");
 
-		if (debugChannelSet(5, kDebugLingoExec))
-			printStack("Stack before: ");
-
-		debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+			Common::String instr = decodeInstruction(_pc);
+			debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		}
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -162,10 +164,15 @@ Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
 		}
 	}
 
-	if (!_localvars || !_localvars->contains(name)) { // Create variable if it was not defined
+	SymbolHash::iterator local;
+	if (_localvars)
+		local = _localvars->find(name);
+
+	if (!_localvars || local == _localvars->end()) { // Create variable if it was not defined
 		// Check if it is a global symbol
-		if (_globalvars.contains(name) && _globalvars[name]->type == SYMBOL)
-			return _globalvars[name];
+		SymbolHash::iterator global = _globalvars.find(name);
+		if (global != _globalvars.end() && global->_value->type == SYMBOL)
+			return global->_value;
 
 		if (!create)
 			return NULL;
@@ -183,7 +190,7 @@ Symbol *Lingo::lookupVar(const char *name, bool create, bool putInGlobalList) {
 			_globalvars[name] = sym;
 		}
 	} else {
-		sym = (*_localvars)[name];
+		sym = local->_value;
 
 		if (sym->global)
 			sym = _globalvars[name];
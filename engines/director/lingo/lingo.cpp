@@ -21,8 +21,10 @@
  */
 
 #include "common/archive.h"
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/str-array.h"
+#include "common/system.h"
 
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-gr.h"
@@ -371,6 +373,9 @@ void Lingo::runTests() {
 
 	int counter = 1;
 
+	// When set, every test script is run repeatedly to time the interpreter
+	int benchmarkIterations = ConfMan.hasKey("lingo_benchmark") ? ConfMan.getInt("lingo_benchmark") : 0;
+
 	for (Common::ArchiveMemberList::iterator it = fsList.begin(); it != fsList.end(); ++it)
 		fileList.push_back((*it)->getName());
 
@@ -388,12 +393,25 @@ void Lingo::runTests() {
 			debug(">> Compiling file %s of size %d, id: %d", fileList[i].c_str(), size, counter);
 
 			_hadError = false;
+			uint32 compileStart = g_system->getMillis();
 			addCode(script, kMovieScript, counter);
+			uint32 compileTime = g_system->getMillis() - compileStart;
 
-			if (!_hadError)
+			if (!_hadError) {
 				executeScript(kMovieScript, counter);
-			else
+
+				if (benchmarkIterations > 0) {
+					uint32 executeStart = g_system->getMillis();
+					for (int iteration = 0; iteration < benchmarkIterations; iteration++)
+						executeScript(kMovieScript, counter);
+					uint32 executeTime = g_system->getMillis() - executeStart;
+
+					debug(">> Benchmark %s: compiled in %d ms, %d runs in %d ms", fileList[i].c_str(),
+						compileTime, benchmarkIterations, executeTime);
+				}
+			} else {
 				debug(">> Skipping execution");
+			}
 
 			free(script);
 
@@ -85,6 +85,10 @@ Score::Score(DirectorEngine *vm) {
 	_stopPlay = false;
 	_stageColor = 0;
 
+	_statsStartTime = 0;
+	_statsFrames = 0;
+	_statsPixels = 0;
+
 	_loadedBitmaps = new Common::HashMap<int, BitmapCast *>();
 	_loadedText = new Common::HashMap<int, TextCast *>();
 	_loadedButtons = new Common::HashMap<int, ButtonCast *>();
@@ -290,6 +294,8 @@ Score::~Score() {
 	delete _surface;
 	delete _trailSurface;
 
+	_screenCopy.free();
+
 	if (_movieArchive)
 		_movieArchive->close();
 
@@ -1184,6 +1190,11 @@ void Score::startLoop() {
 	_stopPlay = false;
 	_nextFrameTime = 0;
 
+	// initGraphics() reset the screen, so the next upload has to be a full one
+	_screenCopy.free();
+	_statsStartTime = g_system->getMillis();
+	_statsFrames = _statsPixels = 0;
+
 	_frames[_currentFrame]->prepareFrame(this);
 
 	while (!_stopPlay && _currentFrame < _frames.size()) {
@@ -1199,8 +1210,8 @@ void Score::update() {
 	if (g_system->getMillis() < _nextFrameTime)
 		return;
 
-	_surface->clear();
-	_surface->copyFrom(*_trailSurface);
+	// Both surfaces have the stage size, so copy in place instead of reallocating
+	_surface->blitFrom(*_trailSurface);
 
 	_lingo->executeImmediateScripts(_frames[_currentFrame]);
 
@@ -1272,6 +1283,74 @@ void Score::update() {
 	_nextFrameTime = g_system->getMillis() + (float)_currentFrameRate / 60 * 1000;
 }
 
+void Score::copyStageToScreen(bool fullUpdate) {
+	const Graphics::Surface &stage = _surface->rawSurface();
+	uint32 pixels = 0;
+
+	if (fullUpdate || _screenCopy.w != stage.w || _screenCopy.h != stage.h || _screenCopy.format != stage.format) {
+		g_system->copyRectToScreen(stage.getPixels(), stage.pitch, 0, 0, stage.w, stage.h);
+		_screenCopy.copyFrom(stage);
+		pixels = stage.w * stage.h;
+	} else {
+		// Most frames only change a few sprites, so compare against what is
+		// on screen and upload each run of changed rows on its own
+		int bpp = stage.format.bytesPerPixel;
+		int rowBytes = stage.w * bpp;
+		int runTop = -1;
+		int runLeft = stage.w, runRight = 0;
+
+		for (int y = 0; y <= stage.h; y++) {
+			bool rowChanged = false;
+
+			if (y < stage.h) {
+				const byte *src = (const byte *)stage.getBasePtr(0, y);
+				const byte *dst = (const byte *)_screenCopy.getBasePtr(0, y);
+
+				if (memcmp(src, dst, rowBytes)) {
+					int first = 0, last = rowBytes - 1;
+					while (src[first] == dst[first])
+						first++;
+					while (src[last] == dst[last])
+						last--;
+
+					runLeft = MIN(runLeft, first / bpp);
+					runRight = MAX(runRight, last / bpp + 1);
+					rowChanged = true;
+				}
+			}
+
+			if (rowChanged) {
+				if (runTop < 0)
+					runTop = y;
+				continue;
+			}
+
+			if (runTop >= 0) {
+				int width = runRight - runLeft;
+				g_system->copyRectToScreen(stage.getBasePtr(runLeft, runTop), stage.pitch, runLeft, runTop, width, y - runTop);
+				for (int row = runTop; row < y; row++)
+					memcpy(_screenCopy.getBasePtr(runLeft, row), stage.getBasePtr(runLeft, row), width * bpp);
+				pixels += width * (y - runTop);
+
+				runTop = -1;
+				runLeft = stage.w;
+				runRight = 0;
+			}
+		}
+	}
+
+	_statsFrames++;
+	_statsPixels += pixels;
+
+	uint32 now = g_system->getMillis();
+	if (now - _statsStartTime >= 1000) {
+		debugC(1, kDebugImages, "Stage: %.1f fps, %d pixels uploaded per frame",
+			_statsFrames * 1000.0 / (now - _statsStartTime), _statsPixels / _statsFrames);
+		_statsStartTime = now;
+		_statsFrames = _statsPixels = 0;
+	}
+}
+
 Sprite *Score::getSpriteById(uint16 id) {
 	if (_currentFrame >= _frames.size() || id >= _frames[_currentFrame]->_sprites.size()) {
 		warning("Score::getSpriteById(%d): out of bounds. frame: %d", id, _currentFrame);
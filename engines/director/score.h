@@ -86,6 +86,12 @@ public:
 	void copyCastStxts();
 	Graphics::ManagedSurface *getSurface() { return _surface; }
 
+	/**
+	 * Uploads the parts of the stage surface which changed since the last
+	 * upload, or the whole stage if fullUpdate is set
+	 */
+	void copyStageToScreen(bool fullUpdate = false);
+
 	void loadCastInto(Sprite *sprite, int castId);
 	Common::Rect getCastMemberInitialRect(int castId);
 	void setCastMemberModified(int castId);
@@ -156,6 +162,11 @@ private:
 	Lingo *_lingo;
 	DirectorSound *_soundManager;
 	DirectorEngine *_vm;
+
+	Graphics::Surface _screenCopy; // what was last uploaded to the screen
+	uint32 _statsStartTime;
+	uint32 _statsFrames;
+	uint32 _statsPixels;
 };
 
 } // End of namespace Director
@@ -391,6 +391,7 @@ RivenConsole::RivenConsole(MohawkEngine_Riven *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("getRMAP",		WRAP_METHOD(RivenConsole, Cmd_GetRMAP));
 	registerCmd("combos",         WRAP_METHOD(RivenConsole, Cmd_Combos));
 	registerCmd("sliderState",    WRAP_METHOD(RivenConsole, Cmd_SliderState));
+	registerCmd("cardTiming",     WRAP_METHOD(RivenConsole, Cmd_CardTiming));
 	registerVar("show_hotspots",  &_vm->_showHotspots);
 }
 
@@ -687,6 +688,25 @@ bool RivenConsole::Cmd_SliderState(int argc, const char **argv) {
 	return true;
 }
 
+bool RivenConsole::Cmd_CardTiming(int argc, const char **argv) {
+	if (argc > 1 && !scumm_stricmp(argv[1], "reset")) {
+		_vm->_lastCardChangeTime = _vm->_maxCardChangeTime = 0;
+		_vm->_totalCardChangeTime = _vm->_cardChangeCount = 0;
+		debugPrintf("Card change timings reset\n");
+		return true;
+	}
+
+	if (_vm->_cardChangeCount == 0) {
+		debugPrintf("No card changes yet\n");
+		return true;
+	}
+
+	debugPrintf("Card changes: %d\n", _vm->_cardChangeCount);
+	debugPrintf("Last: %d ms, average: %d ms, slowest: %d ms\n", _vm->_lastCardChangeTime,
+			_vm->_totalCardChangeTime / _vm->_cardChangeCount, _vm->_maxCardChangeTime);
+	return true;
+}
+
 #endif // ENABLE_RIVEN
 
 LivingBooksConsole::LivingBooksConsole(MohawkEngine_LivingBooks *vm) : GUI::Debugger(), _vm(vm) {
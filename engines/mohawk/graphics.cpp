@@ -68,7 +68,7 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() : _cacheUseCounter(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -86,18 +86,49 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheLastUse.clear();
+}
+
+void GraphicsManager::trimCache(uint32 maxBytes) {
+	uint32 totalBytes = 0;
+	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++)
+		totalBytes += it->_value->getSurface()->pitch * it->_value->getSurface()->h;
+
+	while (totalBytes > maxBytes && !_cache.empty()) {
+		// Find the least recently used image
+		Common::HashMap<uint16, MohawkSurface *>::iterator oldest = _cache.end();
+		uint32 oldestUse = 0;
+		for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			uint32 lastUse = _cacheLastUse.getVal(it->_key, 0);
+			if (oldest == _cache.end() || lastUse < oldestUse) {
+				oldest = it;
+				oldestUse = lastUse;
+			}
+		}
+
+		totalBytes -= oldest->_value->getSurface()->pitch * oldest->_value->getSurface()->h;
+		_cacheLastUse.erase(oldest->_key);
+		delete oldest->_value;
+		_cache.erase(oldest);
+	}
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
-	if (!_cache.contains(id))
-		_cache[id] = decodeImage(id);
+	MohawkSurface *surface;
+
+	Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.find(id);
+	if (it != _cache.end()) {
+		surface = it->_value;
+	} else {
+		surface = decodeImage(id);
+		_cache[id] = surface;
+	}
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// Myst and Living Books clear the cache on every card or page change,
+	// Riven keeps it within a budget using trimCache()
+	_cacheLastUse[id] = ++_cacheUseCounter;
 
-	return _cache[id];
+	return surface;
 }
 
 Common::Array<MohawkSurface *> GraphicsManager::decodeImages(uint16 id) {
@@ -228,6 +259,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 		error("Image %d already in cache", id);
 
 	_cache[id] = surface;
+	_cacheLastUse[id] = ++_cacheUseCounter;
 }
 
 } // End of namespace Mohawk
@@ -74,6 +74,10 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Free the least recently used images until the decoded images in
+	// the cache take up at most maxBytes. Sub-images are left alone.
+	void trimCache(uint32 maxBytes);
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -100,6 +104,8 @@ private:
 	// An image cache that stores images until clearCache() is called
 	Common::HashMap<uint16, MohawkSurface *> _cache;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
+	Common::HashMap<uint16, uint32> _cacheLastUse;
+	uint32 _cacheUseCounter;
 };
 
 } // End of namespace Mohawk
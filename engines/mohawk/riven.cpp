@@ -54,9 +54,17 @@
 
 namespace Mohawk {
 
+// Decoded card images are kept across card changes up to this size,
+// so that going back to a recently visited card does not decode again
+static const uint32 kImageCacheBudget = 16 * 1024 * 1024;
+
 MohawkEngine_Riven::MohawkEngine_Riven(OSystem *syst, const MohawkGameDescription *gamedesc) :
 		MohawkEngine(syst, gamedesc) {
 	_showHotspots = false;
+	_lastCardChangeTime = 0;
+	_maxCardChangeTime = 0;
+	_totalCardChangeTime = 0;
+	_cardChangeCount = 0;
 	_activatedPLST = false;
 	_activatedSLST = false;
 	_gameEnded = false;
@@ -595,9 +603,11 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	uint32 startTime = _system->getMillis();
+
+	// Images of recently visited cards are kept, the cache is
+	// cleared entirely when the stack changes.
+	_gfx->trimCache(kImageCacheBudget);
 
 	if (!(getFeatures() & GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
@@ -623,6 +633,12 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 
 	// Finally, install any hardcoded timer
 	_stack->installCardTimer();
+
+	_lastCardChangeTime = _system->getMillis() - startTime;
+	_maxCardChangeTime = MAX(_maxCardChangeTime, _lastCardChangeTime);
+	_totalCardChangeTime += _lastCardChangeTime;
+	_cardChangeCount++;
+	debug(2, "Changed to card %d in %d ms", dest, _lastCardChangeTime);
 }
 
 Common::SeekableReadStream *MohawkEngine_Riven::getExtrasResource(uint32 tag, uint16 id) {
@@ -97,6 +97,12 @@ public:
 	// Display debug rectangles around the hotspots
 	bool _showHotspots;
 
+	// Card change durations in milliseconds, shown in the console
+	uint32 _lastCardChangeTime;
+	uint32 _maxCardChangeTime;
+	uint32 _totalCardChangeTime;
+	uint32 _cardChangeCount;
+
 	GUI::Debugger *getDebugger() override;
 
 	bool canLoadGameStateCurrently() override;
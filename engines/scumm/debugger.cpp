@@ -30,6 +30,10 @@
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
 #include "scumm/imuse/imuse.h"
+#ifdef ENABLE_SCUMM_7_8
+#include "scumm/imuse_digi/dimuse.h"
+#include "scumm/imuse_digi/dimuse_bndmgr.h"
+#endif
 #include "scumm/object.h"
 #include "scumm/resource.h"
 #include "scumm/scumm.h"
@@ -166,6 +170,21 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 				debugPrintf("Specify a music resource # or \"all\".\n");
 			}
 			return true;
+#ifdef ENABLE_SCUMM_7_8
+		} else if (!strcmp(argv[1], "stats") && _vm->_imuseDigital) {
+			if (argc > 2 && !strcmp(argv[2], "reset")) {
+				BundleMgr::resetBlockCacheStats();
+				_vm->_imuseDigital->resetUnderrunCount();
+				debugPrintf("iMuse Digital statistics reset.\n");
+				return true;
+			}
+
+			uint32 hits, misses;
+			BundleMgr::getBlockCacheStats(hits, misses);
+			debugPrintf("Bundle block cache: %d hits, %d misses\n", hits, misses);
+			debugPrintf("Track underruns: %d\n", _vm->_imuseDigital->getUnderrunCount());
+			return true;
+#endif
 		}
 	}
 
@@ -173,6 +192,10 @@ bool ScummDebugger::Cmd_IMuse(int argc, const char **argv) {
 	debugPrintf("  panic - Stop all music tracks\n");
 	debugPrintf("  play # - Play a music resource\n");
 	debugPrintf("  stop # - Stop a music resource\n");
+#ifdef ENABLE_SCUMM_7_8
+	if (_vm->_imuseDigital)
+		debugPrintf("  stats [reset] - Show iMuse Digital bundle cache and underrun statistics\n");
+#endif
 	return true;
 }
 
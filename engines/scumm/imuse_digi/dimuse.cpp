@@ -51,6 +51,7 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps)
 	_sound = new ImuseDigiSndMgr(_vm);
 	assert(_sound);
 	_callbackFps = fps;
+	_underrunCount = 0;
 	resetState();
 	for (int l = 0; l < MAX_DIGITAL_TRACKS + MAX_DIGITAL_FADETRACKS; l++) {
 		_track[l] = new Track;
@@ -260,6 +261,8 @@ void IMuseDigital::callback() {
 				int32 feedSize = track->feedSize / _callbackFps;
 
 				if (track->stream->endOfData()) {
+					if (track->regionOffset != 0)
+						_underrunCount++;
 					feedSize *= 2;
 				}
 
@@ -56,6 +56,7 @@ class IMuseDigital : public MusicEngine {
 private:
 
 	int _callbackFps;		// value how many times callback needs to be called per second
+	uint32 _underrunCount;	// how often a track ran out of queued data in the middle of a region
 
 	struct TriggerParams {
 		char marker[10];
@@ -125,6 +126,9 @@ public:
 	IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps);
 	virtual ~IMuseDigital();
 
+	uint32 getUnderrunCount() const { return _underrunCount; }
+	void resetUnderrunCount() { _underrunCount = 0; }
+
 	void setAudioNames(int32 num, char *names);
 
 	void startVoice(int soundId, Audio::AudioStream *input);
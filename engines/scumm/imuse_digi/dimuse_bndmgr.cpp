@@ -149,6 +149,9 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
+	_blockCacheData = NULL;
+	_blockCacheCounter = 0;
+	resetBlockCache();
 }
 
 BundleMgr::~BundleMgr() {
@@ -193,8 +196,7 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_indexTable = _cache->getIndexTable(slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
+	resetBlockCache();
 
 	return true;
 }
@@ -206,16 +208,68 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = NULL;
 		free(_compInputBuff);
 		_compInputBuff = NULL;
+		free(_blockCacheData);
+		_blockCacheData = NULL;
+		resetBlockCache();
 	}
 }
 
+uint32 BundleMgr::_blockCacheHits = 0;
+uint32 BundleMgr::_blockCacheMisses = 0;
+
+void BundleMgr::getBlockCacheStats(uint32 &hits, uint32 &misses) {
+	hits = _blockCacheHits;
+	misses = _blockCacheMisses;
+}
+
+void BundleMgr::resetBlockCacheStats() {
+	_blockCacheHits = 0;
+	_blockCacheMisses = 0;
+}
+
+void BundleMgr::resetBlockCache() {
+	for (int i = 0; i < kBlockCacheSize; i++) {
+		_blockCache[i].block = -1;
+		_blockCache[i].outputSize = 0;
+		_blockCache[i].lastUsed = 0;
+		_blockCache[i].data = _blockCacheData ? _blockCacheData + i * 0x2000 : NULL;
+	}
+}
+
+BundleMgr::BlockCacheEntry *BundleMgr::getBlock(int32 index, int32 block) {
+	// Look for the block, remembering the least recently used entry
+	BlockCacheEntry *entry = NULL;
+	for (int i = 0; i < kBlockCacheSize; i++) {
+		if (_blockCache[i].block == block) {
+			_blockCacheHits++;
+			_blockCache[i].lastUsed = ++_blockCacheCounter;
+			return &_blockCache[i];
+		}
+		if (!entry || _blockCache[i].lastUsed < entry->lastUsed)
+			entry = &_blockCache[i];
+	}
+
+	_blockCacheMisses++;
+
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	entry->outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, entry->data, _compTable[block].size);
+	if (entry->outputSize > 0x2000) {
+		error("_outputSize: %d", entry->outputSize);
+	}
+	entry->block = block;
+	entry->lastUsed = ++_blockCacheCounter;
+
+	return entry;
+}
+
 bool BundleMgr::loadCompTable(int32 index) {
 	_file->seek(_bundleTable[index].offset, SEEK_SET);
 	uint32 tag = _file->readUint32BE();
@@ -243,6 +297,10 @@ bool BundleMgr::loadCompTable(int32 index) {
 	_compInputBuff = (byte *)malloc(maxSize + 1);
 	assert(_compInputBuff);
 
+	_blockCacheData = (byte *)malloc(kBlockCacheSize * 0x2000);
+	assert(_blockCacheData);
+	resetBlockCache();
+
 	return true;
 }
 
@@ -287,19 +345,9 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
-		}
+		BlockCacheEntry *block = getBlock(index, i);
 
-		outputSize = _outputSize;
+		outputSize = block->outputSize;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -316,7 +364,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
@@ -74,6 +74,17 @@ private:
 		int32 codec;
 	};
 
+	// Number of decompressed blocks kept per bundle, so that seeking back
+	// within a music region does not decompress the same blocks again
+	enum { kBlockCacheSize = 8 };
+
+	struct BlockCacheEntry {
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte *data;
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
@@ -85,12 +96,18 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
+
+	BlockCacheEntry _blockCache[kBlockCacheSize];
+	byte *_blockCacheData;
+	uint32 _blockCacheCounter;
+
+	static uint32 _blockCacheHits;
+	static uint32 _blockCacheMisses;
 
 	bool loadCompTable(int32 index);
+	void resetBlockCache();
+	BlockCacheEntry *getBlock(int32 index, int32 block);
 
 public:
 
@@ -103,6 +120,9 @@ public:
 	int32 decompressSampleByName(const char *name, int32 offset, int32 size, byte **compFinal, bool headerOutside);
 	int32 decompressSampleByIndex(int32 index, int32 offset, int32 size, byte **compFinal, int header_size, bool headerOutside);
 	int32 decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside);
+
+	static void getBlockCacheStats(uint32 &hits, uint32 &misses);
+	static void resetBlockCacheStats();
 };
 
 } // End of namespace Scumm
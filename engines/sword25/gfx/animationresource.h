@@ -61,6 +61,9 @@ public:
 	Animation::ANIMATION_TYPES getAnimationType() const {
 		return _animationType;
 	}
+	virtual uint getSize() const {
+		return sizeof(*this) + _frames.size() * sizeof(Frame);
+	}
 	int getFPS() const {
 		return _FPS;
 	}
@@ -67,6 +67,15 @@ public:
 		return _pImage->getHeight();
 	}
 
+	/**
+	    @brief Returns the memory used by the bitmap. All image types store 32 bit ARGB pixel data.
+	*/
+	virtual uint getSize() const {
+		if (!_pImage)
+			return sizeof(*this);
+		return sizeof(*this) + _pImage->getWidth() * _pImage->getHeight() * 4;
+	}
+
 	/**
 	    @brief Rendert das Bild in den Framebuffer.
 	    @param PosX die Position auf der X-Achse im Zielbild in Pixeln, an der das Bild gerendert werden soll.<br>
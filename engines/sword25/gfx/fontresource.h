@@ -89,6 +89,13 @@ public:
 		return _characterRects[character];
 	}
 
+	/**
+	    @brief Returns the memory used by the font description. The character map is a separate bitmap resource.
+	*/
+	virtual uint getSize() const {
+		return sizeof(*this);
+	}
+
 	/**
 	    @brief Gibt den Dateinamen der Charactermap zurck.
 	*/
@@ -129,9 +129,8 @@ static int getSubversionRevision(lua_State *L) {
 }
 
 static int getUsedMemory(lua_State *L) {
-	// It doesn't really matter what this call returns,
-	// as it's used in a debug function.
-	lua_pushnumber(L, 0);
+	// This is used in a debug function, so report the memory used by the resource cache
+	lua_pushnumber(L, Kernel::getInstance()->getResourceManager()->getUsedMemory());
 	return 1;
 }
 
@@ -257,7 +256,14 @@ static int processMessages(lua_State *L) {
 	// to the closeWanted() opcode; see also the TODO comment in there.
 
 	lua_pushbooleancpp(L, !Engine::shouldQuit());
-	g_system->delayMillis(10);
+
+	// Use the idle time of the main loop to load resources queued by the
+	// scripts, and only sleep for whatever remains of it
+	uint32 startTime = g_system->getMillis();
+	Kernel::getInstance()->getResourceManager()->processPrefetchQueue(10);
+	uint32 elapsed = g_system->getMillis() - startTime;
+	if (elapsed < 10)
+		g_system->delayMillis(10 - elapsed);
 
 	return 1;
 }
@@ -313,12 +319,23 @@ static int precacheResource(lua_State *L) {
 #ifdef PRECACHE_RESOURCES
 	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1)));
 #else
-	lua_pushbooleancpp(L, true);
+	lua_pushbooleancpp(L, pResource->prefetchResource(luaL_checkstring(L, 1)));
 #endif
 
 	return 1;
 }
 
+static int prefetchResource(lua_State *L) {
+	Kernel *pKernel = Kernel::getInstance();
+	assert(pKernel);
+	ResourceManager *pResource = pKernel->getResourceManager();
+	assert(pResource);
+
+	lua_pushbooleancpp(L, pResource->prefetchResource(luaL_checkstring(L, 1)));
+
+	return 1;
+}
+
 static int forcePrecacheResource(lua_State *L) {
 	Kernel *pKernel = Kernel::getInstance();
 	assert(pKernel);
@@ -340,9 +357,7 @@ static int getMaxMemoryUsage(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-	// This is used for debugging, so it doesn't really matter.
-	// The default value set by the scripts is 256000000 bytes
-	lua_pushnumber(L, 256000000);
+	lua_pushnumber(L, pResource->getMaxMemoryUsage());
 
 	return 1;
 }
@@ -353,8 +368,7 @@ static int setMaxMemoryUsage(lua_State *L) {
 	ResourceManager *pResource = pKernel->getResourceManager();
 	assert(pResource);
 
-	// This call is ignored, we set a limit on the number of
-	// simultaneous resources loaded instead.
+	pResource->setMaxMemoryUsage(static_cast<uint>(luaL_checknumber(L, 1)));
 
 	return 0;
 }
@@ -370,6 +384,17 @@ static int emptyCache(lua_State *L) {
 	return 0;
 }
 
+static int logLoadStatistics(lua_State *L) {
+	Kernel *pKernel = Kernel::getInstance();
+	assert(pKernel);
+	ResourceManager *pResource = pKernel->getResourceManager();
+	assert(pResource);
+
+	pResource->logLoadStatistics();
+
+	return 0;
+}
+
 static int dumpLockedResources(lua_State *L) {
 	Kernel *pKernel = Kernel::getInstance();
 	assert(pKernel);
@@ -386,12 +411,14 @@ static const char *RESOURCE_LIBRARY_NAME = "Resource";
 static const luaL_reg RESOURCE_FUNCTIONS[] = {
 	{"PrecacheResource", precacheResource},
 	{"ForcePrecacheResource", forcePrecacheResource},
+	{"PrefetchResource", prefetchResource},
 	{"GetMaxMemoryUsage", getMaxMemoryUsage},
 	{"SetMaxMemoryUsage", setMaxMemoryUsage},
 	{"EmptyCache", emptyCache},
 	{"IsLogCacheMiss", dummyFuncError},
 	{"SetLogCacheMiss", dummyFuncError},
 	{"DumpLockedResources", dumpLockedResources},
+	{"LogLoadStatistics", logLoadStatistics},
 	{0, 0}
 };
 
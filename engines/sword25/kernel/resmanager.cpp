@@ -29,6 +29,9 @@
  *
  */
 
+#include "common/algorithm.h"
+#include "common/system.h"
+
 #include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/kernel/resmanager.h"
 #include "sword25/kernel/resource.h"
@@ -37,15 +40,22 @@
 
 namespace Sword25 {
 
-// Sets the amount of resources that are simultaneously loaded.
-// This needs to be a relatively high number, as all the animation
-// frames in each scene are loaded as separate resources.
-// Also, George's walk states are all loaded here (150 files)
-#define SWORD25_RESOURCECACHE_MIN 400
-// The maximum number of loaded resources. If more than these resources
-// are loaded, the resource manager will start purging resources till it
-// hits the minimum limit above
-#define SWORD25_RESOURCECACHE_MAX 500
+// The default amount of memory the resource cache may use. This is the
+// value set by the game scripts via Resource.SetMaxMemoryUsage(). It needs
+// to be relatively high, as all the animation frames in each scene are
+// loaded as separate resources, and George's walk states alone are 150 files.
+#define SWORD25_RESOURCECACHE_MAX_MEMORY 256000000
+// Once the memory budget is exceeded, the resource manager purges resources
+// until the used memory drops to this percentage of the budget
+#define SWORD25_RESOURCECACHE_MIN_PERCENT 80
+
+ResourceManager::ResourceManager(Kernel *pKernel) :
+	_kernelPtr(pKernel),
+	_usedMemory(0),
+	_maxMemoryUsage(SWORD25_RESOURCECACHE_MAX_MEMORY),
+	_hitCount(0),
+	_prefetchCount(0) {
+}
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -87,9 +97,11 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_usedMemory < _maxMemoryUsage || _resources.empty())
 		return;
 
+	const uint minMemoryUsage = _maxMemoryUsage / 100 * SWORD25_RESOURCECACHE_MIN_PERCENT;
+
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
 	// The list is processed backwards in order to first release those resources that have been
 	// not been accessed for the longest
@@ -100,14 +112,14 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory >= minMemoryUsage);
 
 	// Are we still above the minimum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
 	// in the resource lock code, and resources are not unlocked when changing rooms.
 	// Only image/animation resources are unlocked forcibly, thus this shouldn't have
 	// any impact on the game itself.
-	if (_resources.size() <= SWORD25_RESOURCECACHE_MIN)
+	if (_usedMemory <= minMemoryUsage || _resources.empty())
 		return;
 
 	iter = _resources.end();
@@ -126,13 +138,21 @@ void ResourceManager::deleteResourcesIfNecessary() {
 
 			iter = deleteResource(*iter);
 		}
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory >= minMemoryUsage);
+}
+
+void ResourceManager::setMaxMemoryUsage(uint maxMemoryUsage) {
+	_maxMemoryUsage = maxMemoryUsage;
+	deleteResourcesIfNecessary();
 }
 
 /**
  * Releases all resources that are not locked.
  */
 void ResourceManager::emptyCache() {
+	// The cache is usually emptied on scene changes, so report the load times of the last scene
+	logLoadStatistics();
+
 	// Scan through the resource list
 	Common::List<Resource *>::iterator iter = _resources.begin();
 	while (iter != _resources.end()) {
@@ -172,8 +192,14 @@ Resource *ResourceManager::requestResource(const Common::String &fileName) {
 	// Determine whether the resource is already loaded
 	// If the resource is found, it will be placed at the head of the resource list and returned
 	Resource *pResource = getResource(uniqueFileName);
-	if (!pResource)
+	if (!pResource) {
+		uint32 startTime = g_system->getMillis();
 		pResource = loadResource(uniqueFileName);
+		if (pResource)
+			_missLoadTimes.push_back(g_system->getMillis() - startTime);
+	} else {
+		++_hitCount;
+	}
 	if (pResource) {
 		moveToFront(pResource);
 		(pResource)->addReference();
@@ -220,6 +246,68 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+/**
+ * Queues a resource to be loaded into the cache in the background.
+ * @param FileName      The filename of the resource to be prefetched
+ * @return              Returns false if the resource could not be found
+ */
+bool ResourceManager::prefetchResource(const Common::String &fileName) {
+	// Get the absolute path to the file
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (uniqueFileName.empty())
+		return false;
+
+	// Nothing to do if the resource is already loaded. It is still moved to the
+	// front of the list, so that it isn't purged before it is requested
+	Resource *pResource = getResource(uniqueFileName);
+	if (pResource) {
+		moveToFront(pResource);
+		return true;
+	}
+
+	_prefetchQueue.push(uniqueFileName);
+	return true;
+}
+
+/**
+ * Loads queued resources until the queue is empty or the time budget is used up
+ * @param TimeBudget    The time in milliseconds that may be spent loading resources
+ */
+void ResourceManager::processPrefetchQueue(uint32 timeBudget) {
+	uint32 startTime = g_system->getMillis();
+
+	while (!_prefetchQueue.empty() && g_system->getMillis() - startTime < timeBudget) {
+		Common::String uniqueFileName = _prefetchQueue.pop();
+
+		// The resource may have been requested in the meantime, or queued more than once
+		if (getResource(uniqueFileName))
+			continue;
+
+		if (loadResource(uniqueFileName))
+			++_prefetchCount;
+	}
+}
+
+/**
+ * Writes the load latency statistics since the last call to the log and resets them
+ */
+void ResourceManager::logLoadStatistics() {
+	if (!_missLoadTimes.empty()) {
+		Common::sort(_missLoadTimes.begin(), _missLoadTimes.end());
+
+		const uint count = _missLoadTimes.size();
+		debugC(kDebugResource, "Resource cache: %d hits, %d misses, %d prefetched, %d/%d bytes used",
+		       _hitCount, count, _prefetchCount, _usedMemory, _maxMemoryUsage);
+		debugC(kDebugResource, "Resource load latency: p50 %d ms, p90 %d ms, p99 %d ms, max %d ms",
+		       _missLoadTimes[count * 50 / 100], _missLoadTimes[count * 90 / 100],
+		       _missLoadTimes[count * 99 / 100], _missLoadTimes[count - 1]);
+	}
+
+	_missLoadTimes.clear();
+	_hitCount = 0;
+	_prefetchCount = 0;
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -260,6 +348,10 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			// Also store the resource in the hash table for quick lookup
 			_resourceHashMap[pResource->getFileName()] = pResource;
 
+			// Account for the memory used by the resource
+			pResource->_size = pResource->getSize();
+			_usedMemory += pResource->_size;
+
 			return pResource;
 		}
 	}
@@ -296,6 +388,9 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
 
+	// Release the memory accounted for the resource
+	_usedMemory -= pResource->_size;
+
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
 
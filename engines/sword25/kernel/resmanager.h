@@ -35,6 +35,7 @@
 #include "common/list.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "common/queue.h"
 
 #include "sword25/kernel/common.h"
 
@@ -66,6 +67,47 @@ public:
 	bool precacheResource(const Common::String &fileName, bool forceReload = false);
 #endif
 
+	/**
+	 * Queues a resource to be loaded into the cache in the background.
+	 * Queued resources are loaded during the idle time of the main loop,
+	 * see processPrefetchQueue(). The resource is not locked.
+	 * @param FileName      The filename of the resource to be prefetched
+	 * @return              Returns false if the resource could not be found
+	 */
+	bool prefetchResource(const Common::String &fileName);
+
+	/**
+	 * Loads queued resources until the queue is empty or the time budget is used up
+	 * @param TimeBudget    The time in milliseconds that may be spent loading resources
+	 */
+	void processPrefetchQueue(uint32 timeBudget);
+
+	/**
+	 * Sets the amount of memory the resource cache may use. If more memory is used,
+	 * the least recently used unlocked resources are released.
+	 * @param MaxMemoryUsage    The memory budget in bytes
+	 */
+	void setMaxMemoryUsage(uint maxMemoryUsage);
+
+	/**
+	 * Returns the memory budget of the resource cache in bytes
+	 */
+	uint getMaxMemoryUsage() const {
+		return _maxMemoryUsage;
+	}
+
+	/**
+	 * Returns the amount of memory currently used by the cached resources in bytes
+	 */
+	uint getUsedMemory() const {
+		return _usedMemory;
+	}
+
+	/**
+	 * Writes the load latency statistics since the last call to the log and resets them
+	 */
+	void logLoadStatistics();
+
 	/**
 	 * Registers a RegisterResourceService. This method is the constructor of
 	 * BS_ResourceService, and thus helps all resource services in the ResourceManager list
@@ -93,9 +135,7 @@ private:
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
-	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
-	{}
+	ResourceManager(Kernel *pKernel);
 	virtual ~ResourceManager();
 
 	/**
@@ -139,6 +179,13 @@ private:
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+	Common::Queue<Common::String> _prefetchQueue;
+
+	uint _usedMemory;                           ///< The memory used by all cached resources
+	uint _maxMemoryUsage;                       ///< The memory budget of the cache
+	Common::Array<uint32> _missLoadTimes;       ///< Load times of cache misses in requestResource()
+	uint _hitCount;                             ///< Number of requests served from the cache
+	uint _prefetchCount;                        ///< Number of resources loaded by the prefetcher
 };
 
 } // End of namespace Sword25
@@ -92,6 +92,14 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the approximate amount of memory used by the resource in bytes.
+	 * This is used by the resource manager to keep the cache within its memory budget.
+	 */
+	virtual uint getSize() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -99,6 +107,7 @@ private:
 	Common::String _fileName;          ///< The absolute filename
 	uint _refCount;          ///< The number of locks
 	uint _type;              ///< The type of the resource
+	uint _size;              ///< The size accounted for this resource in the cache
 	Common::List<Resource *>::iterator _iterator;        ///< Points to the resource position in the LRU list
 };
 
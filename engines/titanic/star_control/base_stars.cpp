@@ -30,6 +30,16 @@
 
 namespace Titanic {
 
+/**
+ * Number of consecutive star entries sharing one culling block
+ */
+#define STAR_BLOCK_SIZE 64
+
+/**
+ * Star sets smaller than this are drawn without block culling
+ */
+#define STAR_BLOCK_MIN_STARS 1024
+
 CBaseStarEntry::CBaseStarEntry() : _red(0), _value(0.0) {
 	Common::fill(&_data[0], &_data[5], 0);
 }
@@ -60,11 +70,14 @@ bool CBaseStarEntry::operator==(const CBaseStarEntry &s) const {
 /*------------------------------------------------------------------------*/
 
 CBaseStars::CBaseStars() : _minVal(0.0), _maxVal(1.0), _range(0.0),
-		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0) {
+		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0),
+		_blocksDataSize(0) {
 }
 
 void CBaseStars::clear() {
 	_data.clear();
+	_blocks.clear();
+	_blocksDataSize = 0;
 }
 
 void CBaseStars::initialize() {
@@ -102,6 +115,8 @@ void CBaseStars::loadData(Common::SeekableReadStream &s) {
 	// Iterate through reading the data for each entry
 	for (uint idx = 0; idx < count; ++idx)
 		_data[idx].load(s);
+
+	updateBlocks();
 }
 
 void CBaseStars::loadData(const CString &resName) {
@@ -126,8 +141,68 @@ void CBaseStars::resetEntry(CBaseStarEntry &entry) {
 		entry._data[idx] = 0;
 }
 
+void CBaseStars::updateBlocks() {
+	if (_blocksDataSize == _data.size())
+		return;
+
+	_blocksDataSize = _data.size();
+	_blocks.clear();
+	if (_data.size() < STAR_BLOCK_MIN_STARS)
+		return;
+
+	_blocks.resize((_data.size() + STAR_BLOCK_SIZE - 1) / STAR_BLOCK_SIZE);
+	for (uint blockNum = 0; blockNum < _blocks.size(); ++blockNum) {
+		CBaseStarBlock &block = _blocks[blockNum];
+		uint startIndex = blockNum * STAR_BLOCK_SIZE;
+		uint endIndex = MIN<uint>(startIndex + STAR_BLOCK_SIZE, _data.size());
+
+		// Use the centre of the bounding box, and the furthest star from it
+		FVector minPos = _data[startIndex]._position, maxPos = minPos;
+		for (uint idx = startIndex + 1; idx < endIndex; ++idx) {
+			const FVector &pos = _data[idx]._position;
+			minPos = FVector(MIN(minPos._x, pos._x), MIN(minPos._y, pos._y), MIN(minPos._z, pos._z));
+			maxPos = FVector(MAX(maxPos._x, pos._x), MAX(maxPos._y, pos._y), MAX(maxPos._z, pos._z));
+		}
+		block._center = FVector((minPos._x + maxPos._x) / 2,
+			(minPos._y + maxPos._y) / 2, (minPos._z + maxPos._z) / 2);
+
+		double radius2 = 0.0;
+		for (uint idx = startIndex; idx < endIndex; ++idx) {
+			const FVector &pos = _data[idx]._position;
+			double dx = (double)pos._x - block._center._x;
+			double dy = (double)pos._y - block._center._y;
+			double dz = (double)pos._z - block._center._z;
+			radius2 = MAX(radius2, dx * dx + dy * dy + dz * dz);
+		}
+		block._radius = sqrt(radius2);
+	}
+}
+
+bool CBaseStars::isBlockCulled(uint startIndex, const FPose &pose, double minVal) const {
+	if (_blocks.empty() || (startIndex % STAR_BLOCK_SIZE) != 0)
+		return false;
+
+	const CBaseStarBlock &block = _blocks[startIndex / STAR_BLOCK_SIZE];
+	double axisLen = sqrt((double)pose._row1._z * pose._row1._z
+		+ (double)pose._row2._z * pose._row2._z + (double)pose._row3._z * pose._row3._z);
+	double centerZ = block._center._x * pose._row1._z + block._center._y * pose._row2._z
+		+ block._center._z * pose._row3._z + pose._vector._z;
+	double maxZ = centerZ + block._radius * axisLen;
+
+	// The per-star depth is calculated in single precision, so leave a
+	// margin for its rounding error to keep the result pixel identical
+	double centerLen = sqrt((double)block._center._x * block._center._x
+		+ (double)block._center._y * block._center._y
+		+ (double)block._center._z * block._center._z);
+	double margin = ((centerLen + block._radius) * axisLen + fabs(pose._vector._z)) * 1.0e-5 + 1.0;
+
+	return maxZ + margin <= minVal;
+}
+
 void CBaseStars::draw(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup) {
 	if (!_data.empty()) {
+		updateBlocks();
+
 		switch (camera->getStarColor()) {
 		case WHITE: // draw white, green, and red stars (mostly white)
 			switch (surfaceArea->_bpp) {
@@ -175,6 +250,11 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double tempX, tempY, tempZ, total2;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
+		if (isBlockCulled(idx, pose, minVal)) {
+			idx += STAR_BLOCK_SIZE - 1;
+			continue;
+		}
+
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
@@ -260,6 +340,11 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double tempX, tempY, tempZ, total2;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
+		if (isBlockCulled(idx, pose, minVal)) {
+			idx += STAR_BLOCK_SIZE - 1;
+			continue;
+		}
+
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
@@ -349,6 +434,11 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
+		if (isBlockCulled(idx, pose, minVal)) {
+			idx += STAR_BLOCK_SIZE - 1;
+			continue;
+		}
+
 		CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
@@ -455,6 +545,11 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
+		if (isBlockCulled(idx, pose, minVal)) {
+			idx += STAR_BLOCK_SIZE - 1;
+			continue;
+		}
+
 		const CBaseStarEntry &entry = _data[idx];
 		const FVector &vector = entry._position;
 
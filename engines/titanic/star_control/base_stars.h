@@ -35,6 +35,7 @@ namespace Titanic {
 enum StarMode { MODE_STARFIELD = 0, MODE_PHOTO = 1 };
 
 class CStarCamera;
+class FPose;
 class CStarCloseup;
 class CString;
 class CSurfaceArea;
@@ -59,6 +60,17 @@ struct CBaseStarEntry {
 	bool operator==(const CBaseStarEntry &s) const;
 };
 
+/**
+ * Bounding sphere of a contiguous run of star entries, used to cull
+ * whole runs that lie behind the camera without projecting each star
+ */
+struct CBaseStarBlock {
+	FVector _center;
+	double _radius;
+
+	CBaseStarBlock() : _radius(0.0) {}
+};
+
 struct CStarPosition : public Common::Point {
 	int _index1;
 	int _index2;
@@ -78,6 +90,20 @@ private:
 	void draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
+
+	/**
+	 * Rebuilds the culling blocks if the star data has changed size
+	 */
+	void updateBlocks();
+
+	/**
+	 * Returns true if every star in the block starting at the given
+	 * entry index is guaranteed to fail the near plane check
+	 */
+	bool isBlockCulled(uint startIndex, const FPose &pose, double minVal) const;
+private:
+	Common::Array<CBaseStarBlock> _blocks;
+	uint _blocksDataSize;
 protected:
 	FRange _minMax;
 	double _minVal;
@@ -48,6 +48,7 @@ Console::Console(ZVision *engine) : GUI::Debugger(), _engine(engine) {
 	registerCmd("raw2wav", WRAP_METHOD(Console, cmdRawToWav));
 	registerCmd("setrenderstate", WRAP_METHOD(Console, cmdSetRenderState));
 	registerCmd("generaterendertable", WRAP_METHOD(Console, cmdGenerateRenderTable));
+	registerCmd("warpbenchmark", WRAP_METHOD(Console, cmdWarpBenchmark));
 	registerCmd("setpanoramafov", WRAP_METHOD(Console, cmdSetPanoramaFoV));
 	registerCmd("setpanoramascale", WRAP_METHOD(Console, cmdSetPanoramaScale));
 	registerCmd("location", WRAP_METHOD(Console, cmdLocation));
@@ -179,6 +180,36 @@ bool Console::cmdGenerateRenderTable(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdWarpBenchmark(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Use %s [<iterations>] to time warping the whole scene with the current render table\n", argv[0]);
+		return true;
+	}
+
+	int iterations = (argc == 2) ? atoi(argv[1]) : 100;
+	if (iterations <= 0)
+		iterations = 100;
+
+	Graphics::Surface source, dest;
+	source.create(_engine->_workingWindow.width(), _engine->_workingWindow.height(), _engine->_resourcePixelFormat);
+	dest.create(source.w, source.h, source.format);
+	memset(source.getPixels(), 0, source.pitch * source.h);
+
+	RenderTable *table = _engine->getRenderManager()->getRenderTable();
+	uint32 startTime = g_system->getMillis();
+	for (int i = 0; i < iterations; ++i)
+		table->mutateImage(&dest, &source);
+	uint32 elapsed = MAX<uint32>(g_system->getMillis() - startTime, 1);
+
+	float megaPixels = (float)source.w * source.h * iterations / 1000000.0f;
+	debugPrintf("Warped %d frames of %dx%d in %d ms (%.1f megapixels/s)\n", iterations, source.w, source.h, elapsed, megaPixels * 1000.0f / elapsed);
+
+	source.free();
+	dest.free();
+
+	return true;
+}
+
 bool Console::cmdSetPanoramaFoV(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Use %s <fieldOfView> to change the current panorama field of view\n", argv[0]);
@@ -42,6 +42,7 @@ private:
 	bool cmdRawToWav(int argc, const char **argv);
 	bool cmdSetRenderState(int argc, const char **argv);
 	bool cmdGenerateRenderTable(int argc, const char **argv);
+	bool cmdWarpBenchmark(int argc, const char **argv);
 	bool cmdSetPanoramaFoV(int argc, const char **argv);
 	bool cmdSetPanoramaScale(int argc, const char **argv);
 	bool cmdLocation(int argc, const char **argv);
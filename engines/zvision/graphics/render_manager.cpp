@@ -116,9 +116,11 @@ void RenderManager::renderSceneToScreen() {
 	RenderTable::RenderState state = _renderTable.getRenderState();
 	if (state == RenderTable::PANORAMA || state == RenderTable::TILT) {
 		if (!_backgroundSurfaceDirtyRect.isEmpty()) {
-			_renderTable.mutateImage(&_warpedSceneSurface, in);
+			// Only warp the part of the scene affected by the changes
+			outWndDirtyRect = _renderTable.getWarpedArea(_backgroundSurfaceDirtyRect);
+			_renderTable.mutateImage(&_warpedSceneSurface, in, outWndDirtyRect);
+			_renderTable.markWarped();
 			out = &_warpedSceneSurface;
-			outWndDirtyRect = Common::Rect(_workingWindow.width(), _workingWindow.height());
 		}
 	} else {
 		out = in;
@@ -36,6 +36,8 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_offsetTable = new uint32[numRows * numColumns];
+	generateOffsetTable();
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -43,10 +45,12 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _offsetTable;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
 	_renderState = newState;
+	_tableChanged = true;
 
 	switch (newState) {
 	case PANORAMA:
@@ -105,25 +109,61 @@ void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 d
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
+	mutateImage(dstBuf, srcBuf, Common::Rect(srcBuf->w, srcBuf->h));
+}
 
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
-	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
+void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &destRect) {
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 
-	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+	for (int16 y = destRect.top; y < destRect.bottom; ++y) {
+		const uint32 *offsets = _offsetTable + y * _numColumns;
+		uint16 *destBuffer = (uint16 *)dstBuf->getBasePtr(0, y);
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+		for (int16 x = destRect.left; x < destRect.right; ++x)
+			destBuffer[x] = sourceBuffer[offsets[x]];
+	}
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+Common::Rect RenderTable::getWarpedArea(const Common::Rect &sourceRect) const {
+	if (_tableChanged)
+		return Common::Rect(_numColumns, _numRows);
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+	Common::Rect area;
+	int16 first = -1, last = -1;
+
+	switch (_renderState) {
+	case PANORAMA:
+		// Each destination column is taken from a single source column
+		for (uint x = 0; x < _numColumns; ++x) {
+			int16 sourceX = x + _internalBuffer[x].x;
+			if (sourceX >= sourceRect.left && sourceX < sourceRect.right) {
+				if (first < 0)
+					first = x;
+				last = x;
+			}
+		}
+		if (first >= 0)
+			area = Common::Rect(first, 0, last + 1, _numRows);
+		break;
+	case TILT:
+		// Each destination row is taken from a single source row
+		for (uint y = 0; y < _numRows; ++y) {
+			int16 sourceY = y + _internalBuffer[y * _numColumns].y;
+			if (sourceY >= sourceRect.top && sourceY < sourceRect.bottom) {
+				if (first < 0)
+					first = y;
+				last = y;
+			}
 		}
+		if (first >= 0)
+			area = Common::Rect(0, first, _numColumns, last + 1);
+		break;
+	case FLAT:
+		area = sourceRect;
+		break;
 	}
+
+	return area;
 }
 
 void RenderTable::generateRenderTable() {
@@ -140,6 +180,22 @@ void RenderTable::generateRenderTable() {
 	}
 }
 
+void RenderTable::generateOffsetTable() {
+	uint32 index = 0;
+
+	for (uint y = 0; y < _numRows; ++y) {
+		for (uint x = 0; x < _numColumns; ++x, ++index) {
+			// RenderTable only stores offsets from the original coordinates
+			uint32 sourceYIndex = y + _internalBuffer[index].y;
+			uint32 sourceXIndex = x + _internalBuffer[index].x;
+
+			_offsetTable[index] = sourceYIndex * _numColumns + sourceXIndex;
+		}
+	}
+
+	_tableChanged = true;
+}
+
 void RenderTable::generatePanoramaLookupTable() {
 	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
 
@@ -172,6 +228,8 @@ void RenderTable::generatePanoramaLookupTable() {
 			_internalBuffer[index].y = yInCylinderCoords - y;
 		}
 	}
+
+	generateOffsetTable();
 }
 
 void RenderTable::generateTiltLookupTable() {
@@ -207,6 +265,8 @@ void RenderTable::generateTiltLookupTable() {
 			_internalBuffer[index].y = yInCylinderCoords - y;
 		}
 	}
+
+	generateOffsetTable();
 }
 
 void RenderTable::setPanoramaFoV(float fov) {
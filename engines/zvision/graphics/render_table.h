@@ -43,6 +43,14 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	/**
+	 * Absolute source pixel offsets for each destination pixel, derived
+	 * from _internalBuffer. Used by mutateImage() to avoid recomputing
+	 * the source position for every pixel.
+	 */
+	uint32 *_offsetTable;
+	/** Set when the table changed and the whole image has to be warped again */
+	bool _tableChanged;
 	RenderState _renderState;
 
 	struct {
@@ -70,8 +78,24 @@ public:
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
 	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf);
+	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &destRect);
 	void generateRenderTable();
 
+	/**
+	 * Returns the area of the warped image that has to be updated when the
+	 * given area of the source image changed. This is the whole image if
+	 * the table itself changed since the last full warp.
+	 */
+	Common::Rect getWarpedArea(const Common::Rect &sourceRect) const;
+
+	/**
+	 * Marks the warped image as up to date with the current table, so
+	 * getWarpedArea() only returns the changed parts from then on. Called
+	 * by the owner of the warped image after warping the area returned by
+	 * getWarpedArea().
+	 */
+	void markWarped() { _tableChanged = false; }
+
 	void setPanoramaFoV(float fov);
 	void setPanoramaScale(float scale);
 	void setPanoramaReverse(bool reverse);
@@ -90,6 +114,7 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void generateOffsetTable();
 };
 
 } // End of namespace ZVision
@@ -22,6 +22,7 @@
 
 #include "common/system.h"
 #include "common/config-manager.h"
+#include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/unzip.h"
@@ -102,6 +103,60 @@ struct WidgetDrawData {
 	void calcBackgroundOffset();
 };
 
+/**
+ * A DrawData item rendered by ThemeEngine::drawCachedDD.
+ *
+ * Draw steps blend with the pixels they are drawn over. Thus, a rendered
+ * item can only be reused over the same pixels it was originally drawn on.
+ */
+struct CachedDrawData {
+	DrawData type;
+	uint32 dynamic;
+	/** Size of the element and its offset inside the drawn area. */
+	Common::Rect area;
+	/**
+	 * Parity of the element's screen position. Gradient dithering is
+	 * phased by the absolute coordinates.
+	 */
+	byte parity;
+	/** Hash of the pixels the item was drawn over. */
+	uint32 hash;
+	/** The pixels the item was drawn over. */
+	Graphics::Surface before;
+	/** The pixels after drawing the item. */
+	Graphics::Surface after;
+
+	uint32 getSize() const {
+		return before.h * before.pitch + after.h * after.pitch;
+	}
+};
+
+/** Memory budget of the widget cache in bytes. */
+static const uint32 kWidgetCacheBudget = 4 * 1024 * 1024;
+
+static uint32 hashSurfaceArea(const Graphics::Surface &surface, const Common::Rect &r) {
+	// FNV-1a
+	uint32 hash = 2166136261U;
+	const uint rowSize = r.width() * surface.format.bytesPerPixel;
+	for (int y = r.top; y < r.bottom; ++y) {
+		const byte *src = (const byte *)surface.getBasePtr(r.left, y);
+		for (uint x = 0; x < rowSize; ++x) {
+			hash = (hash ^ src[x]) * 16777619U;
+		}
+	}
+	return hash;
+}
+
+static bool compareSurfaceArea(const Graphics::Surface &surface, const Common::Rect &r, const Graphics::Surface &copy) {
+	const uint rowSize = r.width() * surface.format.bytesPerPixel;
+	for (int y = 0; y < copy.h; ++y) {
+		if (memcmp(surface.getBasePtr(r.left, r.top + y), copy.getBasePtr(0, y), rowSize) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
 /**********************************************************
  *  Data definitions for theme engine elements
  *********************************************************/
@@ -172,7 +227,8 @@ static const DrawDataInfo kDrawDataDefaults[] = {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
+	_font(0), _widgetCacheSize(0), _widgetCacheHits(0), _widgetCacheMisses(0),
+	_initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(0) {
 
 	_system = g_system;
@@ -221,6 +277,7 @@ ThemeEngine::~ThemeEngine() {
 	_screen.free();
 	_backBuffer.free();
 
+	clearWidgetCache();
 	unloadTheme();
 
 	// Release all graphics surfaces
@@ -439,6 +496,9 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_screen.free();
 	_screen.create(width, height, _overlayFormat);
 
+	// Cached widgets are in the old pixel format.
+	clearWidgetCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
@@ -713,6 +773,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearWidgetCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -851,6 +913,12 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		extendedRect.bottom += drawData->_shadowOffset - drawData->_backgroundOffset;
 	}
 
+	// Only elements which are not clipped at all can use the widget cache.
+	// The rendered result would depend on the clipping otherwise.
+	const bool cacheable = area == r && !area.isEmpty()
+	                    && Common::Rect(_screen.w, _screen.h).contains(extendedRect)
+	                    && (_clip.isEmpty() || _clip.contains(extendedRect));
+
 	if (!_clip.isEmpty()) {
 		extendedRect.clip(_clip);
 	}
@@ -859,13 +927,109 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
+		if (cacheable) {
+			drawCachedDD(type, area, extendedRect, dynamic);
+		} else {
+			Common::List<Graphics::DrawStep>::const_iterator step;
+			for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+				_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+			}
+		}
+
+		addDirtyRect(extendedRect);
+	}
+}
+
+void ThemeEngine::drawCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &drawArea, uint32 dynamic) {
+	Graphics::Surface *surface = _vectorRenderer->getActiveSurface();
+
+	// Very large elements, like dialog backgrounds, are rarely redrawn and
+	// would evict everything else from the cache. Each item stores the area
+	// twice, before and after drawing.
+	const uint32 size = 2 * drawArea.width() * drawArea.height() * surface->format.bytesPerPixel;
+	if (size > kWidgetCacheBudget / 8) {
 		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+		for (step = _widgets[type]->_steps.begin(); step != _widgets[type]->_steps.end(); ++step) {
 			_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
 		}
+		return;
+	}
 
-		addDirtyRect(extendedRect);
+	Common::Rect relativeArea = area;
+	relativeArea.translate(-drawArea.left, -drawArea.top);
+
+	const byte parity = (area.left & 1) | ((area.top & 1) << 1);
+	const uint32 hash = hashSurfaceArea(*surface, drawArea);
+
+	for (Common::List<CachedDrawData *>::iterator i = _widgetCache.begin(); i != _widgetCache.end(); ++i) {
+		CachedDrawData *cached = *i;
+		if (cached->type != type || cached->dynamic != dynamic || cached->hash != hash
+		    || cached->area != relativeArea || cached->parity != parity
+		    || cached->before.w != drawArea.width() || cached->before.h != drawArea.height()
+		    || !compareSurfaceArea(*surface, drawArea, cached->before)) {
+			continue;
+		}
+
+		surface->copyRectToSurface(cached->after, drawArea.left, drawArea.top, Common::Rect(drawArea.width(), drawArea.height()));
+
+		// Move the item to the front of the list, it is the most recently
+		// used one now.
+		_widgetCache.erase(i);
+		_widgetCache.push_front(cached);
+		++_widgetCacheHits;
+		return;
+	}
+
+	++_widgetCacheMisses;
+
+	CachedDrawData *cached = new CachedDrawData();
+	cached->type = type;
+	cached->dynamic = dynamic;
+	cached->area = relativeArea;
+	cached->parity = parity;
+	cached->hash = hash;
+	cached->before.create(drawArea.width(), drawArea.height(), surface->format);
+	cached->before.copyRectToSurface(*surface, 0, 0, drawArea);
+
+	Common::List<Graphics::DrawStep>::const_iterator step;
+	for (step = _widgets[type]->_steps.begin(); step != _widgets[type]->_steps.end(); ++step) {
+		_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
+	}
+
+	cached->after.create(drawArea.width(), drawArea.height(), surface->format);
+	cached->after.copyRectToSurface(*surface, 0, 0, drawArea);
+
+	_widgetCache.push_front(cached);
+	_widgetCacheSize += cached->getSize();
+
+	// Evict the least recently used items until we are in budget again.
+	while (_widgetCacheSize > kWidgetCacheBudget) {
+		CachedDrawData *oldest = _widgetCache.back();
+		_widgetCache.pop_back();
+
+		_widgetCacheSize -= oldest->getSize();
+		oldest->before.free();
+		oldest->after.free();
+		delete oldest;
+	}
+}
+
+void ThemeEngine::clearWidgetCache() {
+	if (_widgetCacheHits || _widgetCacheMisses) {
+		debug(5, "ThemeEngine: Widget cache: %d hits, %d misses, %d bytes used",
+		      _widgetCacheHits, _widgetCacheMisses, _widgetCacheSize);
 	}
+
+	for (Common::List<CachedDrawData *>::iterator i = _widgetCache.begin(); i != _widgetCache.end(); ++i) {
+		(*i)->before.free();
+		(*i)->after.free();
+		delete *i;
+	}
+
+	_widgetCache.clear();
+	_widgetCacheSize = 0;
+	_widgetCacheHits = 0;
+	_widgetCacheMisses = 0;
 }
 
 void ThemeEngine::drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text,
@@ -49,6 +49,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct CachedDrawData;
 struct TextDrawData;
 struct TextColorData;
 class Dialog;
@@ -629,6 +630,25 @@ protected:
 	 * These functions are called from all the Widget drawing methods.
 	 */
 	void drawDD(DrawData type, const Common::Rect &r, uint32 dynamic = 0, bool forceRestore = false);
+
+	/**
+	 * Draws the steps of a DrawData descriptor, reusing a previously rendered
+	 * result from the widget cache when possible.
+	 *
+	 * A result can be reused when the same DrawData item was drawn with the
+	 * same size and dynamic data over the same pixels before.
+	 *
+	 * @param area     Area of the element, fully inside the screen.
+	 * @param drawArea Area touched by drawing the element, including shadows
+	 *                 etc. Must be fully inside the screen and clip area.
+	 */
+	void drawCachedDD(DrawData type, const Common::Rect &area, const Common::Rect &drawArea, uint32 dynamic);
+
+	/**
+	 * Drops all rendered DrawData items from the widget cache.
+	 */
+	void clearWidgetCache();
+
 	void drawDDText(TextData type, TextColor color, const Common::Rect &r, const Common::String &text, bool restoreBg,
 	                bool elipsis, Graphics::TextAlign alignH = Graphics::kTextAlignLeft,
 	                TextAlignVertical alignV = kTextAlignVTop, int deltax = 0,
@@ -718,6 +738,15 @@ protected:
 	/** List of all the dirty screens that must be blitted to the overlay. */
 	Common::List<Common::Rect> _dirtyScreen;
 
+	/** Rendered DrawData items, most recently used first. */
+	Common::List<CachedDrawData *> _widgetCache;
+
+	/** Memory used by the widget cache in bytes. */
+	uint32 _widgetCacheSize;
+
+	/** Widget cache statistics, logged when the cache is cleared. */
+	uint32 _widgetCacheHits, _widgetCacheMisses;
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
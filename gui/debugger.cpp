@@ -50,6 +50,7 @@ namespace GUI {
 
 Debugger::Debugger() {
 	_frameCountdown = 0;
+	_stringStatsFrames = 0;
 	_isActive = false;
 	_errStr = NULL;
 	_firstTime = true;
@@ -78,6 +79,7 @@ Debugger::Debugger() {
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
 	registerCmd("debugflag_disable",	WRAP_METHOD(Debugger, cmdDebugFlagDisable));
+	registerCmd("string_stats",		WRAP_METHOD(Debugger, cmdStringStats));
 }
 
 Debugger::~Debugger() {
@@ -172,6 +174,8 @@ void Debugger::detach() {
 
 // Temporary execution handler
 void Debugger::onFrame() {
+	++_stringStatsFrames;
+
 	// Count down until 0 is reached
 	if (_frameCountdown > 0) {
 		--_frameCountdown;
@@ -781,6 +785,24 @@ bool Debugger::cmdDebugFlagDisable(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdStringStats(int argc, const char **argv) {
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		Common::resetStringAllocationStats();
+		_stringStatsFrames = 0;
+		debugPrintf("String allocation counters reset\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const Common::StringAllocationStats stats = Common::getStringAllocationStats();
+	debugPrintf("String heap allocations: %u (%u bytes) over %u frames\n", stats.allocations, stats.bytes, _stringStatsFrames);
+	if (_stringStatsFrames)
+		debugPrintf("Average per frame: %u (%u bytes)\n", stats.allocations / _stringStatsFrames, stats.bytes / _stringStatsFrames);
+	return true;
+}
+
 // Console handler
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 bool Debugger::debuggerInputCallback(GUI::ConsoleDialog *console, const char *input, void *refCon) {
@@ -150,6 +150,12 @@ private:
 	 */
 	uint _frameCountdown;
 
+	/**
+	 * Number of onFrame() calls since the string allocation counters
+	 * were last reset by the string_stats command.
+	 */
+	uint _stringStatsFrames;
+
 	Common::Array<Var> _vars;
 
 	typedef Common::HashMap<Common::String, Common::SharedPtr<Debuglet>, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CommandsMap;
@@ -232,6 +238,7 @@ protected:
 	bool cmdDebugFlagsList(int argc, const char **argv);
 	bool cmdDebugFlagEnable(int argc, const char **argv);
 	bool cmdDebugFlagDisable(int argc, const char **argv);
+	bool cmdStringStats(int argc, const char **argv);
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 private:
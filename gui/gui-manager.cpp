@@ -318,6 +318,10 @@ void GuiManager::runLoop() {
 	Common::EventManager *eventMan = _system->getEventManager();
 	const uint32 targetFrameDuration = 1000 / 60;
 
+	// Statistics about the time spent redrawing, logged once per second.
+	uint32 statsStartTime = _system->getMillis(true);
+	uint32 statsFrames = 0, statsRedrawTime = 0, statsMaxRedrawTime = 0;
+
 	while (!_dialogStack.empty() && activeDialog == getTopDialog() && !eventMan->shouldQuit()) {
 		uint32 frameStartTime = _system->getMillis(true);
 
@@ -380,7 +384,22 @@ void GuiManager::runLoop() {
 			}
 		}
 
+		const uint32 redrawStartTime = _system->getMillis(true);
 		redraw();
+		const uint32 redrawTime = _system->getMillis(true) - redrawStartTime;
+
+		++statsFrames;
+		statsRedrawTime += redrawTime;
+		statsMaxRedrawTime = MAX(statsMaxRedrawTime, redrawTime);
+		if (redrawStartTime - statsStartTime >= 1000) {
+			if (statsRedrawTime) {
+				debug(5, "GUI: %d frames, redraw took %d ms on average and %d ms at most",
+				      statsFrames, statsRedrawTime / statsFrames, statsMaxRedrawTime);
+			}
+
+			statsStartTime = redrawStartTime;
+			statsFrames = statsRedrawTime = statsMaxRedrawTime = 0;
+		}
 
 		// Delay until the allocated frame time is elapsed to match the target frame rate
 		uint32 actualFrameDuration = _system->getMillis(true) - frameStartTime;
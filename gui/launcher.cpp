@@ -22,7 +22,9 @@
 
 #include "base/version.h"
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
+#include "common/debug.h"
 #include "common/events.h"
 #include "common/fs.h"
 #include "common/gui_options.h"
@@ -89,6 +91,22 @@ enum {
 	kCmdSavePathClear = 'PSAC'
 };
 
+namespace {
+
+struct LauncherEntry {
+	Common::String key;
+	Common::String description;
+	ThemeEngine::FontColor color;
+};
+
+struct LauncherEntryComparator {
+	bool operator()(const LauncherEntry &x, const LauncherEntry &y) const {
+		return scumm_stricmp(x.description.c_str(), y.description.c_str()) < 0;
+	}
+};
+
+} // End of anonymous namespace
+
 #pragma mark -
 
 LauncherDialog::LauncherDialog()
@@ -246,12 +264,12 @@ void LauncherDialog::close() {
 }
 
 void LauncherDialog::updateListing() {
-	StringArray l;
-	ListWidget::ColorList colors;
+	const uint32 startTime = g_system->getMillis();
+
+	Common::Array<LauncherEntry> entries;
 	ThemeEngine::FontColor color;
 
 	// Retrieve a list of all games defined in the config file
-	_domains.clear();
 	const ConfigManager::DomainMap &domains = ConfMan.getGameDomains();
 	ConfigManager::DomainMap::const_iterator iter;
 	for (iter = domains.begin(); iter != domains.end(); ++iter) {
@@ -280,12 +298,7 @@ void LauncherDialog::updateListing() {
 		}
 
 		if (!gameid.empty() && !description.empty()) {
-			// Insert the game into the launcher list
-			int pos = 0, size = l.size();
-
-			while (pos < size && (scumm_stricmp(description.c_str(), l[pos].c_str()) > 0))
-				pos++;
-
+			// Add the game to the launcher list
 			color = ThemeEngine::kFontColorNormal;
 			if (!path.isDirectory()) {
 				color = ThemeEngine::kFontColorAlternate;
@@ -296,12 +309,30 @@ void LauncherDialog::updateListing() {
 				// description += Common::String::format(" (%s)", _("Not found"));
 			}
 
-			l.insert_at(pos, description);
-			colors.insert_at(pos, color);
-			_domains.insert_at(pos, iter->_key);
+			LauncherEntry entry;
+			entry.key = iter->_key;
+			entry.description = description;
+			entry.color = color;
+			entries.push_back(entry);
 		}
 	}
 
+	// Sort the list once all games are known. Inserting each game at its
+	// sorted position is quadratic in the number of games.
+	Common::sort(entries.begin(), entries.end(), LauncherEntryComparator());
+
+	StringArray l;
+	ListWidget::ColorList colors;
+	l.reserve(entries.size());
+	colors.reserve(entries.size());
+	_domains.clear();
+	_domains.reserve(entries.size());
+	for (Common::Array<LauncherEntry>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+		l.push_back(i->description);
+		colors.push_back(i->color);
+		_domains.push_back(i->key);
+	}
+
 	const int oldSel = _list->getSelected();
 	_list->setList(l, &colors);
 	if (oldSel < (int)l.size())
@@ -314,6 +345,8 @@ void LauncherDialog::updateListing() {
 	// Update the filter settings, those are lost when "setList"
 	// is called.
 	_list->setFilter(_searchWidget->getEditString());
+
+	debug(5, "Launcher: Listed %d games in %d ms", l.size(), g_system->getMillis() - startTime);
 }
 
 void LauncherDialog::addGame() {
@@ -655,10 +688,13 @@ void LauncherDialog::handleCommand(CommandSender *sender, uint32 cmd, uint32 dat
 		setResult(-1);
 		close();
 		break;
-	case kSearchCmd:
+	case kSearchCmd: {
 		// Update the active search filter.
+		const uint32 startTime = g_system->getMillis();
 		_list->setFilter(_searchWidget->getEditString());
+		debug(5, "Launcher: Filtered games in %d ms", g_system->getMillis() - startTime);
 		break;
+	}
 	case kSearchClearCmd:
 		// Reset the active search filter, thus showing all games again
 		_searchWidget->setEditString("");
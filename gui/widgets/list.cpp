@@ -161,6 +161,12 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 	_dataList = list;
 	_list = list;
 	_filter.clear();
+
+	_searchList.resize(list.size());
+	for (uint i = 0; i < list.size(); ++i) {
+		_searchList[i] = list[i];
+		_searchList[i].toLowercase();
+	}
 	_listIndex.clear();
 	_listColors.clear();
 
@@ -196,6 +202,9 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 	_dataList.push_back(s);
 	_list.push_back(s);
 
+	_searchList.push_back(s);
+	_searchList.back().toLowercase();
+
 	setFilter(_filter, false);
 
 	scrollBarRecalc();
@@ -675,6 +684,11 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	// When the new filter only extends the old one, which is the case while
+	// typing, everything it matches was also matched by the old filter.
+	// Thus, only the current matches need to be checked.
+	const bool refine = !_filter.empty() && filt.hasPrefix(_filter);
+
 	_filter = filt;
 
 	if (_filter.empty()) {
@@ -686,27 +700,35 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 		// as substrings, ignoring case.
 
 		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		StringArray words;
+		while (!tok.empty())
+			words.push_back(tok.nextToken());
+
+		Common::Array<int> candidates;
+		if (refine) {
+			candidates = _listIndex;
+		} else {
+			candidates.resize(_dataList.size());
+			for (uint i = 0; i < _dataList.size(); ++i)
+				candidates[i] = i;
+		}
 
 		_list.clear();
 		_listIndex.clear();
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
+		for (Common::Array<int>::const_iterator i = candidates.begin(); i != candidates.end(); ++i) {
+			const String &entry = _searchList[*i];
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+			for (StringArray::const_iterator word = words.begin(); word != words.end(); ++word) {
+				if (!entry.contains(*word)) {
 					matches = false;
 					break;
 				}
 			}
 
 			if (matches) {
-				_list.push_back(*i);
-				_listIndex.push_back(n);
+				_list.push_back(_dataList[*i]);
+				_listIndex.push_back(*i);
 			}
 		}
 	}
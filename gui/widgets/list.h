@@ -55,6 +55,7 @@ public:
 protected:
 	StringArray		_list;
 	StringArray		_dataList;
+	StringArray		_searchList;	///< Lower case copy of _dataList, used for filtering
 	ColorList		_listColors;
 	Common::Array<int>		_listIndex;
 	bool			_editable;
@@ -58,74 +58,67 @@ inline uint16 createDitherTableIndex(const byte *clipTable, byte y, int8 u, int8
 }
 
 /**
- * Put a raw pixel to the destination surface
+ * Get a codebook color, already converted to the output pixel format
  */
 template<typename PixelInt>
-inline void putPixelRaw(PixelInt *dst, const byte *clipTable, const Graphics::PixelFormat &format, byte y, byte u, byte v) {
-	*dst = convertYUVToColor(clipTable, format, y, u, v);
+inline PixelInt getCodebookColor(const CinepakCodebook &codebook, int index) {
+	return codebook.rgb[index];
 }
 
 /**
- * Specialized putPixelRaw for palettized 8bpp output
+ * Specialized getCodebookColor for palettized 8bpp output
  */
 template<>
-inline void putPixelRaw(byte *dst, const byte *clipTable, const Graphics::PixelFormat &format, byte y, byte u, byte v) {
-	*dst = y;
+inline byte getCodebookColor(const CinepakCodebook &codebook, int index) {
+	return codebook.y[index];
 }
 
 /**
  * The default codebook converter: raw output.
+ *
+ * The codebooks are converted to the output format when they are loaded,
+ * so this only needs to store the colors.
  */
 struct CodebookConverterRaw {
 	template<typename PixelInt>
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, PixelInt *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
 		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		putPixelRaw(rows[0] + 0, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[0] + 1, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 0, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 1, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-
-		putPixelRaw(rows[0] + 2, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[0] + 3, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 2, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 3, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-
-		putPixelRaw(rows[2] + 0, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[2] + 1, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 0, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 1, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-
-		putPixelRaw(rows[2] + 2, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[2] + 3, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 2, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 3, clipTable, format, codebook.y[3], codebook.u, codebook.v);
+		const PixelInt color0 = getCodebookColor<PixelInt>(codebook, 0);
+		const PixelInt color1 = getCodebookColor<PixelInt>(codebook, 1);
+		const PixelInt color2 = getCodebookColor<PixelInt>(codebook, 2);
+		const PixelInt color3 = getCodebookColor<PixelInt>(codebook, 3);
+
+		rows[0][0] = rows[0][1] = rows[1][0] = rows[1][1] = color0;
+		rows[0][2] = rows[0][3] = rows[1][2] = rows[1][3] = color1;
+		rows[2][0] = rows[2][1] = rows[3][0] = rows[3][1] = color2;
+		rows[2][2] = rows[2][3] = rows[3][2] = rows[3][3] = color3;
 	}
 
 	template<typename PixelInt>
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, PixelInt *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
 		const CinepakCodebook &codebook1 = strip.v4_codebook[codebookIndex[0]];
-		putPixelRaw(rows[0] + 0, clipTable, format, codebook1.y[0], codebook1.u, codebook1.v);
-		putPixelRaw(rows[0] + 1, clipTable, format, codebook1.y[1], codebook1.u, codebook1.v);
-		putPixelRaw(rows[1] + 0, clipTable, format, codebook1.y[2], codebook1.u, codebook1.v);
-		putPixelRaw(rows[1] + 1, clipTable, format, codebook1.y[3], codebook1.u, codebook1.v);
+		rows[0][0] = getCodebookColor<PixelInt>(codebook1, 0);
+		rows[0][1] = getCodebookColor<PixelInt>(codebook1, 1);
+		rows[1][0] = getCodebookColor<PixelInt>(codebook1, 2);
+		rows[1][1] = getCodebookColor<PixelInt>(codebook1, 3);
 
 		const CinepakCodebook &codebook2 = strip.v4_codebook[codebookIndex[1]];
-		putPixelRaw(rows[0] + 2, clipTable, format, codebook2.y[0], codebook2.u, codebook2.v);
-		putPixelRaw(rows[0] + 3, clipTable, format, codebook2.y[1], codebook2.u, codebook2.v);
-		putPixelRaw(rows[1] + 2, clipTable, format, codebook2.y[2], codebook2.u, codebook2.v);
-		putPixelRaw(rows[1] + 3, clipTable, format, codebook2.y[3], codebook2.u, codebook2.v);
+		rows[0][2] = getCodebookColor<PixelInt>(codebook2, 0);
+		rows[0][3] = getCodebookColor<PixelInt>(codebook2, 1);
+		rows[1][2] = getCodebookColor<PixelInt>(codebook2, 2);
+		rows[1][3] = getCodebookColor<PixelInt>(codebook2, 3);
 
 		const CinepakCodebook &codebook3 = strip.v4_codebook[codebookIndex[2]];
-		putPixelRaw(rows[2] + 0, clipTable, format, codebook3.y[0], codebook3.u, codebook3.v);
-		putPixelRaw(rows[2] + 1, clipTable, format, codebook3.y[1], codebook3.u, codebook3.v);
-		putPixelRaw(rows[3] + 0, clipTable, format, codebook3.y[2], codebook3.u, codebook3.v);
-		putPixelRaw(rows[3] + 1, clipTable, format, codebook3.y[3], codebook3.u, codebook3.v);
+		rows[2][0] = getCodebookColor<PixelInt>(codebook3, 0);
+		rows[2][1] = getCodebookColor<PixelInt>(codebook3, 1);
+		rows[3][0] = getCodebookColor<PixelInt>(codebook3, 2);
+		rows[3][1] = getCodebookColor<PixelInt>(codebook3, 3);
 
 		const CinepakCodebook &codebook4 = strip.v4_codebook[codebookIndex[3]];
-		putPixelRaw(rows[2] + 2, clipTable, format, codebook4.y[0], codebook4.u, codebook4.v);
-		putPixelRaw(rows[2] + 3, clipTable, format, codebook4.y[1], codebook4.u, codebook4.v);
-		putPixelRaw(rows[3] + 2, clipTable, format, codebook4.y[2], codebook4.u, codebook4.v);
-		putPixelRaw(rows[3] + 3, clipTable, format, codebook4.y[3], codebook4.u, codebook4.v);
+		rows[2][2] = getCodebookColor<PixelInt>(codebook4, 0);
+		rows[2][3] = getCodebookColor<PixelInt>(codebook4, 1);
+		rows[3][2] = getCodebookColor<PixelInt>(codebook4, 2);
+		rows[3][3] = getCodebookColor<PixelInt>(codebook4, 3);
 	}
 };
 
@@ -512,6 +505,8 @@ void CinepakDecoder::initializeCodebook(uint16 strip, byte codebookType) {
 		codebook[i].u = 0;
 		codebook[i].v = 0;
 
+		convertCodebook(codebook[i]);
+
 		if (_ditherType == kDitherTypeQT)
 			ditherCodebookQT(strip, codebookType, i);
 	}
@@ -550,6 +545,8 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
+			convertCodebook(codebook[i]);
+
 			// Dither the codebook if we're dithering for QuickTime
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
@@ -557,6 +554,15 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 	}
 }
 
+void CinepakDecoder::convertCodebook(CinepakCodebook &codebook) const {
+	// Palettized and dithered output use the YUV values directly
+	if (_pixelFormat.bytesPerPixel == 1)
+		return;
+
+	for (int i = 0; i < 4; i++)
+		codebook.rgb[i] = convertYUVToColor(_clipTable, _pixelFormat, codebook.y[i], codebook.u, codebook.v);
+}
+
 void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 codebookIndex) {
 	if (codebookType == 1) {
 		const CinepakCodebook &codebook = _curFrame.strips[strip].v1_codebook[codebookIndex];
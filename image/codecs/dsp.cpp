@@ -0,0 +1,147 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "image/codecs/dsp.h"
+
+#include "common/util.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define DSP_SSE2
+#endif
+
+namespace Image {
+
+namespace DSP {
+
+void putPixels(byte *dst, const byte *src, int pitch, int width, int height) {
+	for (int y = 0; y < height; y++) {
+		memcpy(dst, src, width);
+		src += pitch;
+		dst += pitch;
+	}
+}
+
+void putPixelsX2(byte *dst, const byte *src, int pitch, int width, int height) {
+	for (int y = 0; y < height; y++) {
+		int x = 0;
+
+#ifdef DSP_SSE2
+		for (; x + 16 <= width; x += 16) {
+			__m128i a = _mm_loadu_si128((const __m128i *)(src + x));
+			__m128i b = _mm_loadu_si128((const __m128i *)(src + x + 1));
+			_mm_storeu_si128((__m128i *)(dst + x), _mm_avg_epu8(a, b));
+		}
+
+		for (; x + 8 <= width; x += 8) {
+			__m128i a = _mm_loadl_epi64((const __m128i *)(src + x));
+			__m128i b = _mm_loadl_epi64((const __m128i *)(src + x + 1));
+			_mm_storel_epi64((__m128i *)(dst + x), _mm_avg_epu8(a, b));
+		}
+#endif
+
+		for (; x < width; x++)
+			dst[x] = (src[x] + src[x + 1] + 1) >> 1;
+
+		src += pitch;
+		dst += pitch;
+	}
+}
+
+void putPixelsY2(byte *dst, const byte *src, int pitch, int width, int height) {
+	for (int y = 0; y < height; y++) {
+		const byte *next = src + pitch;
+		int x = 0;
+
+#ifdef DSP_SSE2
+		for (; x + 16 <= width; x += 16) {
+			__m128i a = _mm_loadu_si128((const __m128i *)(src + x));
+			__m128i b = _mm_loadu_si128((const __m128i *)(next + x));
+			_mm_storeu_si128((__m128i *)(dst + x), _mm_avg_epu8(a, b));
+		}
+
+		for (; x + 8 <= width; x += 8) {
+			__m128i a = _mm_loadl_epi64((const __m128i *)(src + x));
+			__m128i b = _mm_loadl_epi64((const __m128i *)(next + x));
+			_mm_storel_epi64((__m128i *)(dst + x), _mm_avg_epu8(a, b));
+		}
+#endif
+
+		for (; x < width; x++)
+			dst[x] = (src[x] + next[x] + 1) >> 1;
+
+		src = next;
+		dst += pitch;
+	}
+}
+
+void putPixelsXY2(byte *dst, const byte *src, int pitch, int width, int height) {
+#ifdef DSP_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+#endif
+
+	for (int y = 0; y < height; y++) {
+		const byte *next = src + pitch;
+		int x = 0;
+
+#ifdef DSP_SSE2
+		for (; x + 8 <= width; x += 8) {
+			__m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + x)), zero);
+			__m128i b = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + x + 1)), zero);
+			__m128i c = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(next + x)), zero);
+			__m128i d = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(next + x + 1)), zero);
+			__m128i sum = _mm_add_epi16(_mm_add_epi16(a, b), _mm_add_epi16(c, d));
+			sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+			_mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(sum, sum));
+		}
+#endif
+
+		for (; x < width; x++)
+			dst[x] = (src[x] + src[x + 1] + next[x] + next[x + 1] + 2) >> 2;
+
+		src = next;
+		dst += pitch;
+	}
+}
+
+void clampToByte(byte *dst, const int16 *src, int count, int bias) {
+	int x = 0;
+
+#ifdef DSP_SSE2
+	// Saturating to 16 bits first does not change the result of
+	// clamping to 8 bits.
+	const __m128i biasVec = _mm_set1_epi16(bias);
+
+	for (; x + 8 <= count; x += 8) {
+		__m128i v = _mm_adds_epi16(_mm_loadu_si128((const __m128i *)(src + x)), biasVec);
+		_mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(v, v));
+	}
+#endif
+
+	for (; x < count; x++)
+		dst[x] = CLIP<int>(src[x] + bias, 0, 255);
+}
+
+} // End of namespace DSP
+
+} // End of namespace Image
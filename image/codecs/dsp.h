@@ -0,0 +1,72 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef IMAGE_CODECS_DSP_H
+#define IMAGE_CODECS_DSP_H
+
+#include "common/scummsys.h"
+
+namespace Image {
+
+/**
+ * Pixel kernels shared between the video codecs.
+ *
+ * The functions work on 8-bit planes with an arbitrary pitch. On x86
+ * CPUs with SSE2 they process 8 or 16 pixels at a time, everywhere else
+ * a portable implementation producing the same output is used.
+ */
+namespace DSP {
+
+/**
+ * Copy a block of pixels.
+ */
+void putPixels(byte *dst, const byte *src, int pitch, int width, int height);
+
+/**
+ * Copy a block of pixels, interpolated half a pixel to the right.
+ * Reads width + 1 pixels from every row.
+ */
+void putPixelsX2(byte *dst, const byte *src, int pitch, int width, int height);
+
+/**
+ * Copy a block of pixels, interpolated half a pixel down.
+ * Reads height + 1 rows.
+ */
+void putPixelsY2(byte *dst, const byte *src, int pitch, int width, int height);
+
+/**
+ * Copy a block of pixels, interpolated half a pixel to the right and
+ * half a pixel down. Reads height + 1 rows of width + 1 pixels.
+ */
+void putPixelsXY2(byte *dst, const byte *src, int pitch, int width, int height);
+
+/**
+ * Add a bias to a row of 16-bit samples and clamp the results to the
+ * 0-255 range. The bias has to fit into 16 bits.
+ */
+void clampToByte(byte *dst, const int16 *src, int count, int bias);
+
+} // End of namespace DSP
+
+} // End of namespace Image
+
+#endif
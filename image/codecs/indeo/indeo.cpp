@@ -27,6 +27,7 @@
 #include "image/codecs/indeo/indeo.h"
 #include "image/codecs/indeo/indeo_dsp.h"
 #include "image/codecs/indeo/mem.h"
+#include "image/codecs/dsp.h"
 #include "graphics/yuv_to_rgb.h"
 #include "common/system.h"
 #include "common/algorithm.h"
@@ -927,8 +928,7 @@ void IndeoDecoderBase::outputPlane(IVIPlaneDesc *_plane, uint8 *dst, int dstPitc
 		return;
 
 	for (int y = 0; y < _plane->_height; y++) {
-		for (int x = 0; x < _plane->_width; x++)
-			dst[x] = avClipUint8(src[x] + 128);
+		DSP::clampToByte(dst, src, _plane->_width, 128);
 		src += pitch;
 		dst += dstPitch;
 	}
@@ -111,12 +111,11 @@ void MSVideo1Decoder::decode8(Common::SeekableReadStream &stream) {
                 }
             } else {
                 // 1-color encoding
-                colors[0] = byte_a;
+                uint32 color4 = byte_a * 0x01010101;
 
                 for (byte pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (byte pixel_x = 0; pixel_x < 4; pixel_x++)
-                        pixels[pixelPtr++] = colors[0];
-                    pixelPtr -= rowDec;
+                    WRITE_UINT32(&pixels[pixelPtr], color4);
+                    pixelPtr -= stride;
                 }
             }
 
@@ -198,12 +197,12 @@ void MSVideo1Decoder::decode16(Common::SeekableReadStream &stream) {
                 }
             } else {
                 /* otherwise, it's a 1-color block */
-                colors[0] = (byte_b << 8) | byte_a;
+                uint32 color2 = ((byte_b << 8) | byte_a) * 0x00010001;
 
                 for (int pixel_y = 0; pixel_y < 4; pixel_y++) {
-                    for (int pixel_x = 0; pixel_x < 4; pixel_x++)
-                        pixels[pixel_ptr++] = colors[0];
-                    pixel_ptr -= row_dec;
+                    WRITE_UINT32(&pixels[pixel_ptr], color2);
+                    WRITE_UINT32(&pixels[pixel_ptr + 2], color2);
+                    pixel_ptr -= stride;
                 }
             }
 
@@ -65,25 +65,14 @@ RPZADecoder::~RPZADecoder() {
 
 struct BlockDecoderRaw {
 	static inline void drawFillBlock(uint16 *blockPtr, uint16 pitch, uint16 color, const byte *colorMap) {
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
-		blockPtr += pitch;
-		blockPtr[0] = color;
-		blockPtr[1] = color;
-		blockPtr[2] = color;
-		blockPtr[3] = color;
+		// Fill two pixels at a time
+		uint32 color2 = color | (color << 16);
+
+		for (int i = 0; i < 4; i++) {
+			WRITE_UINT32(blockPtr, color2);
+			WRITE_UINT32(blockPtr + 2, color2);
+			blockPtr += pitch;
+		}
 	}
 
 	static inline void drawRawBlock(uint16 *blockPtr, uint16 pitch, const uint16 (&colors)[16], const byte *colorMap) {
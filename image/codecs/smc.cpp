@@ -132,10 +132,9 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 				blockPtr = rowPtr + pixelPtr;
 				prevBlockPtr = prevBlockPtr1;
 				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixels[prevBlockPtr++];
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
+					WRITE_UINT32(&pixels[blockPtr], READ_UINT32(&pixels[prevBlockPtr]));
+					blockPtr += _surface->w;
+					prevBlockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -178,11 +177,9 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 				prevBlockFlag = !prevBlockFlag;
 
 				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixels[prevBlockPtr++];
-
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
+					WRITE_UINT32(&pixels[blockPtr], READ_UINT32(&pixels[prevBlockPtr]));
+					blockPtr += _surface->w;
+					prevBlockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -192,15 +189,13 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 		case 0x60:
 		case 0x70:
 			numBlocks = GET_BLOCK_COUNT();
-			pixel = stream.readByte();
+			pixel = stream.readByte() * 0x01010101;
 
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
 				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++)
-						pixels[blockPtr++] = pixel;
-
-					blockPtr += rowInc;
+					WRITE_UINT32(&pixels[blockPtr], pixel);
+					blockPtr += _surface->w;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -24,6 +24,7 @@
 // Based off FFmpeg's SVQ1 decoder (written by Arpi and Nick Kurshev)
 
 #include "image/codecs/svq1.h"
+#include "image/codecs/dsp.h"
 #include "image/codecs/svq1_cb.h"
 #include "image/codecs/svq1_vlc.h"
 
@@ -527,90 +528,6 @@ void SVQ1Decoder::svq1SkipBlock(byte *current, byte *previous, int pitch, int x,
 	}
 }
 
-void SVQ1Decoder::putPixels8C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int i = 0; i < h; i++) {
-		*((uint32 *)block) = READ_UINT32(pixels);
-		*((uint32 *)(block + 4)) = READ_UINT32(pixels + 4);
-		pixels += lineSize;
-		block += lineSize;
-	}
-}
-
-static inline uint32 rndAvg32(uint32 a, uint32 b) {
-	return (a | b) - (((a ^ b) & ~0x01010101) >> 1);
-}
-
-void SVQ1Decoder::putPixels8L2(byte *dst, const byte *src1, const byte *src2,
-		int dstStride, int srcStride1, int srcStride2, int h) {
-	for (int i = 0; i < h; i++) {
-		uint32 a = READ_UINT32(&src1[srcStride1 * i]);
-		uint32 b = READ_UINT32(&src2[srcStride2 * i]);
-		*((uint32 *)&dst[dstStride * i]) = rndAvg32(a, b);
-		a = READ_UINT32(&src1[srcStride1 * i + 4]);
-		b = READ_UINT32(&src2[srcStride2 * i + 4]);
-		*((uint32 *)&dst[dstStride * i + 4]) = rndAvg32(a, b);
-	}
-}
-
-void SVQ1Decoder::putPixels8X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + 1, lineSize, lineSize, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels8Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + lineSize, lineSize, lineSize, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels8XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int j = 0; j < 2; j++) {
-		uint32 a = READ_UINT32(pixels);
-		uint32 b = READ_UINT32(pixels + 1);
-		uint32 l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-		uint32 h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-
-		pixels += lineSize;
-
-		for (int i = 0; i < h; i += 2) {
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			uint32 l1 = (a & 0x03030303UL) + (b & 0x03030303UL);
-			uint32 h1 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-			h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
-		}
-
-		pixels += 4 - lineSize * (h + 1);
-		block += 4 - lineSize * h;
-	}
-}
-
-void SVQ1Decoder::putPixels16C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8C(block, pixels, lineSize, h);
-	putPixels8C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8X2C(block, pixels, lineSize, h);
-	putPixels8X2C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8Y2C(block, pixels, lineSize, h);
-	putPixels8Y2C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8XY2C(block, pixels, lineSize, h);
-	putPixels8XY2C(block + 8, pixels + 8, lineSize, h);
-}
-
 bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream32BEMSB *ss, byte *current, byte *previous, int pitch,
 		Common::Point *motion, int x, int y) {
 
@@ -646,16 +563,16 @@ bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream32BEMSB *ss, byte *curre
 	// for 16x16 blocks
 	switch(((mv.y & 1) << 1) + (mv.x & 1)) {
 	case 0:
-		putPixels16C(dst, src, pitch, 16);
+		DSP::putPixels(dst, src, pitch, 16, 16);
 		break;
 	case 1:
-		putPixels16X2C(dst, src, pitch, 16);
+		DSP::putPixelsX2(dst, src, pitch, 16, 16);
 		break;
 	case 2:
-		putPixels16Y2C(dst, src, pitch, 16);
+		DSP::putPixelsY2(dst, src, pitch, 16, 16);
 		break;
 	case 3:
-		putPixels16XY2C(dst, src, pitch, 16);
+		DSP::putPixelsXY2(dst, src, pitch, 16, 16);
 		break;
 	}
 
@@ -726,16 +643,16 @@ bool SVQ1Decoder::svq1MotionInter4vBlock(Common::BitStream32BEMSB *ss, byte *cur
 		// for 8x8 blocks
 		switch(((mvy & 1) << 1) + (mvx & 1)) {
 		case 0:
-			putPixels8C(dst, src, pitch, 8);
+			DSP::putPixels(dst, src, pitch, 8, 8);
 			break;
 		case 1:
-			putPixels8X2C(dst, src, pitch, 8);
+			DSP::putPixelsX2(dst, src, pitch, 8, 8);
 			break;
 		case 2:
-			putPixels8Y2C(dst, src, pitch, 8);
+			DSP::putPixelsY2(dst, src, pitch, 8, 8);
 			break;
 		case 3:
-			putPixels8XY2C(dst, src, pitch, 8);
+			DSP::putPixelsXY2(dst, src, pitch, 8, 8);
 			break;
 		}
 
@@ -142,6 +142,31 @@ class StringTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(foo2, "hhhhh");
 	}
 
+	void test_allocationStats() {
+		Common::resetStringAllocationStats();
+
+		// Short strings use the internal storage
+		Common::String foo1("foo");
+		foo1 += "bar";
+		TS_ASSERT_EQUALS(Common::getStringAllocationStats().allocations, 0u);
+
+		// Long strings need a heap allocation, copies share it
+		Common::String foo2("fooasdkadklasdjklasdjlkasjdlkasjdklasjdlkjasdasd");
+		Common::String foo3(foo2);
+		TS_ASSERT_EQUALS(Common::getStringAllocationStats().allocations, 1u);
+		TS_ASSERT_LESS_THAN(foo2.size(), Common::getStringAllocationStats().bytes);
+
+		// Assigning a short string to a shared string does not allocate
+		foo3 = "x";
+		TS_ASSERT_EQUALS(foo3, "x");
+		TS_ASSERT_EQUALS(foo2, "fooasdkadklasdjklasdjlkasjdlkasjdklasjdlkjasdasd");
+		TS_ASSERT_EQUALS(Common::getStringAllocationStats().allocations, 1u);
+
+		Common::resetStringAllocationStats();
+		TS_ASSERT_EQUALS(Common::getStringAllocationStats().allocations, 0u);
+		TS_ASSERT_EQUALS(Common::getStringAllocationStats().bytes, 0u);
+	}
+
 	void test_self_asignment() {
 		Common::String foo1("12345678901234567890123456789012");
 		foo1 = foo1.c_str() + 2;
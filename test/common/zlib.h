@@ -0,0 +1,55 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/zlib.h"
+
+class ZlibTestSuite : public CxxTest::TestSuite {
+	public:
+	void roundTrip(bool fast) {
+#ifdef USE_ZLIB
+		Common::MemoryWriteStreamDynamic *compressed = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *stream = Common::wrapCompressedWriteStream(compressed, fast);
+
+		// Mix many small writes with ones larger than the internal buffers
+		byte large[40000];
+		for (uint i = 0; i < sizeof(large); ++i)
+			large[i] = (byte)(i * 7);
+
+		for (uint i = 0; i < 10000; ++i)
+			stream->writeUint16LE(i);
+		stream->write(large, sizeof(large));
+		for (uint i = 0; i < 100; ++i)
+			stream->writeByte(i);
+		stream->finalize();
+		TS_ASSERT(!stream->err());
+		TS_ASSERT_EQUALS(stream->pos(), 20000 + (int32)sizeof(large) + 100);
+
+		// The compressed stream owns the wrapped one, but not its data
+		byte *data = compressed->getData();
+		uint32 size = compressed->size();
+		delete stream;
+
+		Common::SeekableReadStream *input = Common::wrapCompressedReadStream(new Common::MemoryReadStream(data, size, DisposeAfterUse::YES));
+		TS_ASSERT(input);
+
+		for (uint i = 0; i < 10000; ++i)
+			TS_ASSERT_EQUALS(input->readUint16LE(), i);
+		byte check[sizeof(large)];
+		TS_ASSERT_EQUALS(input->read(check, sizeof(check)), sizeof(check));
+		TS_ASSERT(!memcmp(check, large, sizeof(large)));
+		for (uint i = 0; i < 100; ++i)
+			TS_ASSERT_EQUALS(input->readByte(), i);
+		input->readByte();
+		TS_ASSERT(input->eos());
+		delete input;
+#endif
+	}
+
+	void test_roundTrip() {
+		roundTrip(false);
+	}
+
+	void test_roundTripFast() {
+		roundTrip(true);
+	}
+};
@@ -0,0 +1,120 @@
+#include <cxxtest/TestSuite.h>
+
+#include "image/codecs/dsp.h"
+
+/**
+ * Checks the shared codec kernels in image/codecs/dsp.h against the
+ * scalar code the codecs used before.
+ */
+class DSPTestSuite : public CxxTest::TestSuite {
+	enum {
+		kPitch = 40,
+		kRows = 18
+	};
+
+	byte _src[kPitch * kRows];
+	byte _dst[kPitch * kRows];
+	uint32 _seed;
+
+	byte nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return (_seed >> 16) & 0xFF;
+	}
+
+	void fill() {
+		_seed = 1;
+		for (int i = 0; i < kPitch * kRows; i++)
+			_src[i] = nextRandom();
+
+		// Make sure the extremes are covered
+		_src[0] = _src[1] = _src[kPitch] = _src[kPitch + 1] = 255;
+		_src[2] = _src[3] = _src[kPitch + 2] = _src[kPitch + 3] = 0;
+		memset(_dst, 0xAA, sizeof(_dst));
+	}
+
+	// Rounding average of four bytes at once, as done by the SVQ1 decoder
+	static uint32 rndAvg32(uint32 a, uint32 b) {
+		return (a | b) - (((a ^ b) & ~0x01010101) >> 1);
+	}
+
+	static byte avg4(byte a, byte b, byte c, byte d) {
+		uint32 l = (a & 3) + (b & 3) + (c & 3) + (d & 3) + 2;
+		uint32 h = ((a & 0xFC) >> 2) + ((b & 0xFC) >> 2) + ((c & 0xFC) >> 2) + ((d & 0xFC) >> 2);
+		return h + ((l >> 2) & 0x0F);
+	}
+
+	static byte rndAvg(byte a, byte b) {
+		return rndAvg32(a, b) & 0xFF;
+	}
+
+	void checkUntouched(int width, int height) {
+		for (int y = 0; y < kRows; y++)
+			for (int x = 0; x < kPitch; x++)
+				if (y >= height || x >= width)
+					TS_ASSERT_EQUALS(_dst[y * kPitch + x], 0xAA);
+	}
+
+public:
+	void test_put_pixels() {
+		static const int widths[] = { 8, 16, 5, 23 };
+
+		for (int i = 0; i < ARRAYSIZE(widths); i++) {
+			int width = widths[i];
+
+			fill();
+			Image::DSP::putPixels(_dst, _src, kPitch, width, 16);
+			for (int y = 0; y < 16; y++)
+				for (int x = 0; x < width; x++)
+					TS_ASSERT_EQUALS(_dst[y * kPitch + x], _src[y * kPitch + x]);
+			checkUntouched(width, 16);
+
+			fill();
+			Image::DSP::putPixelsX2(_dst, _src, kPitch, width, 16);
+			for (int y = 0; y < 16; y++)
+				for (int x = 0; x < width; x++)
+					TS_ASSERT_EQUALS(_dst[y * kPitch + x], rndAvg(_src[y * kPitch + x], _src[y * kPitch + x + 1]));
+			checkUntouched(width, 16);
+
+			fill();
+			Image::DSP::putPixelsY2(_dst, _src, kPitch, width, 16);
+			for (int y = 0; y < 16; y++)
+				for (int x = 0; x < width; x++)
+					TS_ASSERT_EQUALS(_dst[y * kPitch + x], rndAvg(_src[y * kPitch + x], _src[(y + 1) * kPitch + x]));
+			checkUntouched(width, 16);
+
+			fill();
+			Image::DSP::putPixelsXY2(_dst, _src, kPitch, width, 16);
+			for (int y = 0; y < 16; y++) {
+				for (int x = 0; x < width; x++) {
+					const byte *p = &_src[y * kPitch + x];
+					TS_ASSERT_EQUALS(_dst[y * kPitch + x], avg4(p[0], p[1], p[kPitch], p[kPitch + 1]));
+				}
+			}
+			checkUntouched(width, 16);
+		}
+	}
+
+	void test_clamp_to_byte() {
+		int16 src[37];
+		byte dst[37];
+
+		_seed = 7;
+		for (int i = 0; i < ARRAYSIZE(src); i++)
+			src[i] = (int16)((nextRandom() << 8) | nextRandom());
+
+		src[0] = -32768;
+		src[1] = 32767;
+		src[2] = -129;
+		src[3] = -128;
+		src[4] = 127;
+		src[5] = 128;
+
+		Image::DSP::clampToByte(dst, src, ARRAYSIZE(src), 128);
+
+		for (int i = 0; i < ARRAYSIZE(src); i++) {
+			int expected = src[i] + 128;
+			expected = expected < 0 ? 0 : (expected > 255 ? 255 : expected);
+			TS_ASSERT_EQUALS(dst[i], expected);
+		}
+	}
+};
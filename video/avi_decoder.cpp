@@ -166,6 +166,18 @@ const Graphics::Surface *AVIDecoder::decodeNextTransparency() {
 	if (!_transparencyTrack.track)
 		return nullptr;
 
+	// The transparency track has been read ahead along with the video, so
+	// its frame was decoded and queued together with the one just shown
+	if (isDecodingAhead())
+		return getShownAuxFrame();
+
+	return decodeNextAuxFrame();
+}
+
+const Graphics::Surface *AVIDecoder::decodeNextAuxFrame() {
+	if (!_transparencyTrack.track)
+		return nullptr;
+
 	AVIVideoTrack *track = static_cast<AVIVideoTrack *>(_transparencyTrack.track);
 	return track->decodeNextFrame();
 }
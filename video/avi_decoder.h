@@ -102,6 +102,8 @@ protected:
 	bool seekIntern(const Audio::Timestamp &time);
 	bool supportsAudioTrackSwitching() const { return true; }
 	AudioTrack *getAudioTrack(int index);
+	const Graphics::Surface *decodeNextAuxFrame();
+	bool supportsDecodeAhead() const { return true; }
 
 	/**
 	 * Define a track to be used by this class.
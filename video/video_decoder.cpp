@@ -25,14 +25,32 @@
 #include "audio/audiostream.h"
 #include "audio/mixer.h" // for kMaxChannelVolume
 
+#include "common/debug.h"
 #include "common/rational.h"
 #include "common/file.h"
 #include "common/system.h"
 
 #include "graphics/palette.h"
+#include "graphics/surface.h"
 
 namespace Video {
 
+/**
+ * A frame decoded ahead of time, along with the state of the video
+ * it was decoded in.
+ */
+struct VideoDecoder::DecodedFrame {
+	Graphics::Surface surface;
+	Graphics::Surface auxSurface;
+	uint32 startTime;
+	int curFrame;
+	bool hasPalette;
+	byte palette[256 * 3];
+
+	DecodedFrame() : startTime(0), curFrame(-1), hasPalette(false) {}
+	~DecodedFrame() { surface.free(); auxSurface.free(); }
+};
+
 VideoDecoder::VideoDecoder() {
 	_startTime = 0;
 	_dirtyPalette = false;
@@ -50,6 +68,15 @@ VideoDecoder::VideoDecoder() {
 	_mainAudioTrack = 0;
 	_canSetDither = true;
 
+	_decodeAheadDepth = 0;
+	_decodeAheadRunning = false;
+	_decodeAheadCost = 0;
+	_shownFrame = 0;
+	_shownCurFrame = -1;
+	_decodedNextFrameStartTime = 0;
+	_decodedEndOfVideoTracks = false;
+	_frameDeadlineMisses = 0;
+
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
 
@@ -57,10 +84,25 @@ VideoDecoder::VideoDecoder() {
 		_defaultHighColorFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
 }
 
+VideoDecoder::~VideoDecoder() {
+	// Subclasses have to close() in their destructor, which also drops
+	// the frames decoded ahead
+	assert(!_decodeAheadRunning);
+	delete _shownFrame;
+}
+
 void VideoDecoder::close() {
+	stopDecodeAhead();
+
 	if (isPlaying())
 		stop();
 
+	delete _shownFrame;
+	_shownFrame = 0;
+
+	if (_frameDeadlineMisses)
+		debug(1, "VideoDecoder: %d frames missed their deadline", _frameDeadlineMisses);
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		delete *it;
 
@@ -80,6 +122,7 @@ void VideoDecoder::close() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_frameDeadlineMisses = 0;
 }
 
 bool VideoDecoder::loadFile(const Common::String &filename) {
@@ -94,7 +137,14 @@ bool VideoDecoder::loadFile(const Common::String &filename) {
 }
 
 bool VideoDecoder::needsUpdate() const {
-	return hasFramesLeft() && getTimeToNextFrame() == 0;
+	const bool update = hasFramesLeft() && getTimeToNextFrame() == 0;
+
+	// Engines poll this while waiting for the next frame, so use that
+	// time to decode ahead
+	if (!update && _decodeAheadRunning)
+		const_cast<VideoDecoder *>(this)->decodeAhead();
+
+	return update;
 }
 
 void VideoDecoder::pauseVideo(bool pause) {
@@ -185,23 +235,26 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
 	_canSetDither = false;
 
-	readNextPacket();
+	if (!_decodeAheadRunning && _decodeAheadDepth != 0 && isPlaying())
+		startDecodeAhead();
 
-	// If we have no next video track at this point, there shouldn't be
-	// any frame available for us to display.
-	if (!_nextVideoTrack)
-		return 0;
+	if (_decodeAheadRunning) {
+		if (_decodeAheadDepth != 0 || hasDecodedFrames())
+			return nextDecodedFrame();
 
-	const Graphics::Surface *frame = _nextVideoTrack->decodeNextFrame();
+		// Decoding ahead was disabled and all queued frames have been shown
+		stopDecodeAhead();
+	}
 
-	if (_nextVideoTrack->hasDirtyPalette()) {
-		_palette = _nextVideoTrack->getPalette();
+	const byte *palette = 0;
+	const Graphics::Surface *frame = decodeFrameIntern(palette);
+
+	if (palette) {
+		_palette = palette;
 		_dirtyPalette = true;
 	}
 
-	// Look for the next video track here for the next decode.
-	findNextVideoTrack();
-
+	checkFrameDeadline();
 	return frame;
 }
 
@@ -210,6 +263,20 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	if (reverse && _decodeAheadRunning) {
+		// Give the frames decoded ahead back before changing direction.
+		// This needs a seek, without one the queued frames would be lost.
+		bool framesQueued = hasDecodedFrames();
+		if (framesQueued && !isSeekable())
+			return false;
+
+		Audio::Timestamp resumeTime(getQueuedNextFrameStartTime(), 1000);
+		stopDecodeAhead();
+
+		if (framesQueued && !seekIntern(resumeTime))
+			return false;
+	}
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -230,6 +297,13 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	if (_decodeAheadRunning)
+		return _shownCurFrame;
+
+	return getTracksCurFrame();
+}
+
+int VideoDecoder::getTracksCurFrame() const {
 	int32 frame = -1;
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
@@ -271,13 +345,28 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (endOfVideo() || _needsUpdate)
 		return 0;
 
+	uint32 nextFrameStartTime;
+	bool reversed = false;
+
+	if (_decodeAheadRunning) {
+		if (queuedVideoEnded())
+			return 0;
+
+		nextFrameStartTime = getQueuedNextFrameStartTime();
+	} else {
+		if (!_nextVideoTrack)
+			return 0;
+
+		nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+		reversed = _nextVideoTrack->isReversed();
+	}
+
 	uint32 currentTime = getTime();
-	uint32 nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
 
-	if (_nextVideoTrack->isReversed()) {
+	if (reversed) {
 		// For reversed videos, we need to handle the time difference the opposite way.
 		if (nextFrameStartTime >= currentTime)
 			return 0;
@@ -293,9 +382,16 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	// While decoding ahead, the video tracks are ahead of what is shown
+	if (_decodeAheadRunning && hasFramesLeft())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		const Track *track = *it;
 
+		if (_decodeAheadRunning && track->getTrackType() == Track::kTrackTypeVideo)
+			continue;
+
 		bool videoEndTimeReached = _endTimeSet && track->getTrackType() == Track::kTrackTypeVideo && ((const VideoTrack *)track)->getNextFrameStartTime() >= (uint)_endTime.msecs();
 		bool endReached = track->endOfTrack() || (isPlaying() && videoEndTimeReached);
 		if (!endReached)
@@ -320,6 +416,9 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	// Frames decoded ahead are from before the rewind
+	stopDecodeAhead();
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -354,6 +453,9 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	// Frames decoded ahead are from before the seek
+	stopDecodeAhead();
+
 	// Stop all tracks so they can be seeked
 	if (isPlaying())
 		stopAudio();
@@ -915,6 +1017,9 @@ bool VideoDecoder::hasFramesLeft() const {
 	// This is similar to endOfVideo(), except it doesn't take Audio into account (and returns true if not the end of the video)
 	// This is only used for needsUpdate() atm so that setEndTime() works properly
 	// And unlike endOfVideoTracks(), this takes into account _endTime
+	if (_decodeAheadRunning)
+		return !queuedVideoEnded();
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() != Track::kTrackTypeVideo)
 			continue;
@@ -955,4 +1060,153 @@ void VideoDecoder::eraseTrack(Track *track) {
 	}
 }
 
+void VideoDecoder::decodeAhead() {
+	if (!isPlaying() || isPaused())
+		return;
+
+	// Only start on a frame if the slowest recent one would still have
+	// been done before the next frame is due
+	while (_decodedFrames.size() < _decodeAheadDepth && !_decodedEndOfVideoTracks) {
+		if (getTimeToNextFrame() <= _decodeAheadCost)
+			break;
+
+		queueDecodedFrame();
+	}
+}
+
+void VideoDecoder::startDecodeAhead() {
+	if (_decodeAheadRunning || !isVideoLoaded() || !supportsDecodeAhead())
+		return;
+
+	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((const VideoTrack *)*it)->isReversed())
+			return;
+
+	_shownCurFrame = getTracksCurFrame();
+	_decodedNextFrameStartTime = _nextVideoTrack ? _nextVideoTrack->getNextFrameStartTime() : 0;
+	_decodedEndOfVideoTracks = endOfVideoTracks();
+	_decodeAheadCost = 0;
+	_decodeAheadRunning = true;
+}
+
+void VideoDecoder::stopDecodeAhead() {
+	if (!_decodeAheadRunning)
+		return;
+
+	_decodeAheadRunning = false;
+
+	for (DecodedFrameList::iterator it = _decodedFrames.begin(); it != _decodedFrames.end(); it++)
+		delete *it;
+
+	_decodedFrames.clear();
+}
+
+const Graphics::Surface *VideoDecoder::decodeFrameIntern(const byte *&palette) {
+	readNextPacket();
+
+	// If we have no next video track at this point, there shouldn't be
+	// any frame available for us to display.
+	if (!_nextVideoTrack)
+		return 0;
+
+	const Graphics::Surface *frame = _nextVideoTrack->decodeNextFrame();
+
+	if (_nextVideoTrack->hasDirtyPalette())
+		palette = _nextVideoTrack->getPalette();
+
+	// Look for the next video track here for the next decode.
+	findNextVideoTrack();
+
+	return frame;
+}
+
+void VideoDecoder::queueDecodedFrame() {
+	const uint32 decodeStartTime = g_system->getMillis();
+
+	DecodedFrame *frame = new DecodedFrame();
+	frame->startTime = _nextVideoTrack ? _nextVideoTrack->getNextFrameStartTime() : 0;
+
+	const byte *palette = 0;
+	const Graphics::Surface *surface = decodeFrameIntern(palette);
+
+	// Track surfaces are reused for the next frame, so keep a copy
+	if (surface)
+		frame->surface.copyFrom(*surface);
+
+	if (palette) {
+		memcpy(frame->palette, palette, sizeof(frame->palette));
+		frame->hasPalette = true;
+	}
+
+	// The auxiliary track is demuxed along with the video, so it has to be
+	// decoded now as well to stay in step with the frame
+	const Graphics::Surface *auxSurface = decodeNextAuxFrame();
+	if (auxSurface)
+		frame->auxSurface.copyFrom(*auxSurface);
+
+	frame->curFrame = getTracksCurFrame();
+
+	_decodedFrames.push_back(frame);
+	_decodedNextFrameStartTime = _nextVideoTrack ? _nextVideoTrack->getNextFrameStartTime() : 0;
+	_decodedEndOfVideoTracks = endOfVideoTracks();
+
+	// Keep track of the slowest recent decode, slowly forgetting about it
+	_decodeAheadCost = MAX<uint32>(g_system->getMillis() - decodeStartTime, _decodeAheadCost * 7 / 8);
+}
+
+const Graphics::Surface *VideoDecoder::nextDecodedFrame() {
+	if (!hasDecodedFrames()) {
+		// Decoding ahead did not keep up, decode the frame right away
+		queueDecodedFrame();
+	}
+
+	delete _shownFrame;
+
+	_shownFrame = _decodedFrames.front();
+	_decodedFrames.pop_front();
+
+	_shownCurFrame = _shownFrame->curFrame;
+
+	if (_shownFrame->hasPalette) {
+		// The frame is deleted once the next one is shown, but engines may
+		// keep using the palette until it changes again
+		memcpy(_shownPalette, _shownFrame->palette, sizeof(_shownPalette));
+		_palette = _shownPalette;
+		_dirtyPalette = true;
+	}
+
+	checkFrameDeadline();
+	return _shownFrame->surface.getPixels() ? &_shownFrame->surface : 0;
+}
+
+const Graphics::Surface *VideoDecoder::getShownAuxFrame() const {
+	if (!_shownFrame || !_shownFrame->auxSurface.getPixels())
+		return 0;
+
+	return &_shownFrame->auxSurface;
+}
+
+bool VideoDecoder::hasDecodedFrames() const {
+	return !_decodedFrames.empty();
+}
+
+uint32 VideoDecoder::getQueuedNextFrameStartTime() const {
+	if (!_decodedFrames.empty())
+		return _decodedFrames.front()->startTime;
+
+	return _decodedNextFrameStartTime;
+}
+
+bool VideoDecoder::queuedVideoEnded() const {
+	if (_decodedFrames.empty() && _decodedEndOfVideoTracks)
+		return true;
+
+	return _endTimeSet && isPlaying() && getQueuedNextFrameStartTime() >= (uint)_endTime.msecs();
+}
+
+void VideoDecoder::checkFrameDeadline() {
+	if (isPlaying() && !isPaused() && hasFramesLeft() && getTimeToNextFrame() == 0)
+		_frameDeadlineMisses++;
+}
+
 } // End of namespace Video
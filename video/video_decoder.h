@@ -26,6 +26,7 @@
 #include "audio/mixer.h"
 #include "audio/timestamp.h"	// TODO: Move this to common/ ?
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rational.h"
 #include "common/str.h"
 #include "graphics/pixelformat.h"
@@ -52,7 +53,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -229,6 +230,33 @@ public:
 	 */
 	Audio::Timestamp getEndTime() const { return _endTime; }
 
+	/**
+	 * Set the number of frames to decode ahead.
+	 *
+	 * When enabled, up to the given number of frames are demuxed and
+	 * decoded ahead of the one being displayed while needsUpdate() is
+	 * polled and the next frame is not due yet, so that decodeNextFrame()
+	 * only has to hand out an already decoded frame. A frame is only
+	 * decoded ahead if the slowest recent one would have been done before
+	 * the next frame is due. Audio demuxed along the way is queued to the
+	 * audio streams right away, so their buffered audio grows by the same
+	 * amount.
+	 *
+	 * Decoding ahead starts with the first decodeNextFrame() call of a
+	 * forward playing video and is suspended for videos playing in
+	 * reverse. It is off by default, and only decoders which support it
+	 * (see supportsDecodeAhead()) honor this. Passing 0 disables decoding
+	 * ahead once the queued frames have been shown.
+	 *
+	 * @param frames the maximum number of frames to queue
+	 */
+	void setDecodeAhead(uint frames) { _decodeAheadDepth = frames; }
+
+	/**
+	 * Get the number of frames to decode ahead.
+	 */
+	uint getDecodeAhead() const { return _decodeAheadDepth; }
+
 
 	/////////////////////////////////////////
 	// Playback Status
@@ -268,6 +296,13 @@ public:
 	 */
 	uint32 getTime() const;
 
+	/**
+	 * Returns the number of frames which missed their deadline, i.e. the
+	 * frames after which the next frame was already due by the time
+	 * decodeNextFrame() returned.
+	 */
+	uint32 getFrameDeadlineMissCount() const { return _frameDeadlineMisses; }
+
 
 	/////////////////////////////////////////
 	// Video Info
@@ -926,6 +961,39 @@ protected:
 	 */
 	virtual AudioTrack *getAudioTrack(int index) { return 0; }
 
+	/**
+	 * Returns whether this decoder can decode frames ahead.
+	 *
+	 * Decoding ahead moves the stream and the video tracks past the frame
+	 * being shown. Subclasses which only touch them from readNextPacket()
+	 * and decodeNextFrame(), and queue any other per-frame data through
+	 * decodeNextAuxFrame(), can return true here.
+	 */
+	virtual bool supportsDecodeAhead() const { return false; }
+
+	/**
+	 * Decode the next frame of an auxiliary track which accompanies the
+	 * video frames, such as a transparency mask.
+	 *
+	 * While decoding ahead, this is called right after each video frame
+	 * is decoded, and the result is queued along with the frame. It can
+	 * be retrieved with getShownAuxFrame() once the frame is shown.
+	 *
+	 * @return the decoded surface, or 0 if there is none
+	 */
+	virtual const Graphics::Surface *decodeNextAuxFrame() { return 0; }
+
+	/**
+	 * Returns whether frames are currently decoded ahead.
+	 */
+	bool isDecodingAhead() const { return _decodeAheadRunning; }
+
+	/**
+	 * Returns the auxiliary surface queued along with the frame returned
+	 * by the last decodeNextFrame() call while decoding ahead, or 0.
+	 */
+	const Graphics::Surface *getShownAuxFrame() const;
+
 private:
 	// Tracks owned by this VideoDecoder
 	TrackList _tracks;
@@ -964,6 +1032,33 @@ private:
 	Audio::Mixer::SoundType _soundType;
 
 	AudioTrack *_mainAudioTrack;
+
+	// Decoding ahead
+	struct DecodedFrame;
+	typedef Common::List<DecodedFrame *> DecodedFrameList;
+
+	uint _decodeAheadDepth;
+	bool _decodeAheadRunning;
+	DecodedFrameList _decodedFrames;
+	uint32 _decodeAheadCost;	///< Slowest recent frame decode in ms
+	DecodedFrame *_shownFrame;
+	byte _shownPalette[256 * 3];
+	int _shownCurFrame;
+	uint32 _decodedNextFrameStartTime;
+	bool _decodedEndOfVideoTracks;
+	uint32 _frameDeadlineMisses;
+
+	void decodeAhead();
+	void startDecodeAhead();
+	void stopDecodeAhead();
+	const Graphics::Surface *decodeFrameIntern(const byte *&palette);
+	void queueDecodedFrame();
+	const Graphics::Surface *nextDecodedFrame();
+	bool hasDecodedFrames() const;
+	uint32 getQueuedNextFrameStartTime() const;
+	bool queuedVideoEnded() const;
+	int getTracksCurFrame() const;
+	void checkFrameDeadline();
 };
 
 } // End of namespace Video